@@ -0,0 +1,230 @@
+/**
+ * @file
+ *
+ * @brief Allocators for array storage.
+ *
+ * @details
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef ALLOCATORS_HPP
+#define ALLOCATORS_HPP
+
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace util
+{
+
+/**
+ * @brief Tag requesting to leave elements uninitialized.
+ */
+struct uninitialized_t
+{
+	explicit uninitialized_t() = default;
+};
+
+/// Tag requesting to leave elements uninitialized.
+inline constexpr uninitialized_t uninitialized{};
+
+/**
+ * @brief Allocator adaptor which default initializes instead of value initializing.
+ *
+ * @details Containers construct elements without arguments via the allocator,
+ *          which then leaves trivial types uninitialized instead of zeroing them.
+ *          Construction with arguments goes to the adapted allocator.
+ */
+template<typename ALLOC>
+class DefaultInitAllocator: public ALLOC
+{
+	typedef std::allocator_traits<ALLOC> traits_t;
+
+public:
+	template<typename U>
+	struct rebind
+	{
+		typedef DefaultInitAllocator<typename traits_t::template rebind_alloc<U>> other;
+	};
+
+	using ALLOC::ALLOC;
+
+	DefaultInitAllocator() = default;
+
+	DefaultInitAllocator(const ALLOC &alloc) noexcept: ALLOC(alloc) {}
+
+	template<typename OALLOC>
+	DefaultInitAllocator(const DefaultInitAllocator<OALLOC> &other) noexcept:
+		ALLOC(static_cast<const OALLOC&>(other))
+	{
+	}
+
+	template<typename U>
+	void construct(U *ptr) noexcept(std::is_nothrow_default_constructible_v<U>)
+	{
+		::new(static_cast<void*>(ptr)) U;
+	}
+
+	template<typename U, typename... ARGS>
+	void construct(U *ptr, ARGS&&... args)
+	{
+		traits_t::construct(static_cast<ALLOC&>(*this), ptr, std::forward<ARGS>(args)...);
+	}
+
+	DefaultInitAllocator select_on_container_copy_construction() const
+	{
+		return traits_t::select_on_container_copy_construction(*this);
+	}
+};
+
+template<typename ALLOC1, typename ALLOC2>
+bool operator==(const DefaultInitAllocator<ALLOC1> &a1, const DefaultInitAllocator<ALLOC2> &a2)
+{
+	return static_cast<const ALLOC1&>(a1) == static_cast<const ALLOC2&>(a2);
+}
+
+template<typename ALLOC1, typename ALLOC2>
+bool operator!=(const DefaultInitAllocator<ALLOC1> &a1, const DefaultInitAllocator<ALLOC2> &a2)
+{
+	return !(a1 == a2);
+}
+
+/**
+ * @brief Allocator with guaranteed alignment, 64 bytes (a cache line) by default.
+ */
+template<typename T, size_t ALIGN = 64>
+class AlignedAllocator
+{
+public:
+
+	static_assert(ALIGN && !(ALIGN & (ALIGN - 1)), "Alignment must be a power of two.");
+	static_assert(ALIGN >= alignof(T), "Alignment cannot be smaller than the type alignment.");
+
+	typedef T value_type;
+	typedef std::true_type is_always_equal;
+
+	template<typename U>
+	struct rebind
+	{
+		typedef AlignedAllocator<U, ALIGN> other;
+	};
+
+	AlignedAllocator() = default;
+
+	template<typename U>
+	AlignedAllocator(const AlignedAllocator<U, ALIGN>&) noexcept {}
+
+	T* allocate(size_t n)
+	{
+		return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(ALIGN)));
+	}
+
+	void deallocate(T *ptr, size_t)
+	{
+		::operator delete(ptr, std::align_val_t(ALIGN));
+	}
+
+	template<typename U>
+	bool operator==(const AlignedAllocator<U, ALIGN>&) const
+	{
+		return true;
+	}
+
+	template<typename U>
+	bool operator!=(const AlignedAllocator<U, ALIGN>&) const
+	{
+		return false;
+	}
+};
+
+/**
+ * @brief Allocator backing large allocations with transparent huge pages.
+ *
+ * @details Allocations of at least THRESHOLD bytes are aligned and padded to the huge page size
+ *          and advised to the kernel as huge page candidates, which reduces TLB misses
+ *          when traversing large arrays. Smaller allocations are cache line aligned.
+ *          The advice is ignored where not supported.
+ */
+template<typename T, size_t THRESHOLD = (size_t(1) << 21)>
+class HugePageAllocator
+{
+public:
+
+	/// Huge page size assumed (2 MiB on x86-64 and most ARM64 systems).
+	constexpr static size_t HUGE_PAGE_SIZE = size_t(1) << 21;
+
+	typedef T value_type;
+	typedef std::true_type is_always_equal;
+
+	template<typename U>
+	struct rebind
+	{
+		typedef HugePageAllocator<U, THRESHOLD> other;
+	};
+
+	HugePageAllocator() = default;
+
+	template<typename U>
+	HugePageAllocator(const HugePageAllocator<U, THRESHOLD>&) noexcept {}
+
+	T* allocate(size_t n)
+	{
+		const size_t bytes = n * sizeof(T);
+
+		if(bytes < THRESHOLD)
+			return static_cast<T*>(::operator new(bytes, std::align_val_t(SMALL_ALIGN)));
+
+		const size_t paddedBytes = padded(bytes);
+		void *ptr = ::operator new(paddedBytes, std::align_val_t(HUGE_PAGE_SIZE));
+#ifdef MADV_HUGEPAGE
+		madvise(ptr, paddedBytes, MADV_HUGEPAGE);
+#endif
+		return static_cast<T*>(ptr);
+	}
+
+	void deallocate(T *ptr, size_t n)
+	{
+		const size_t bytes = n * sizeof(T);
+
+		if(bytes < THRESHOLD)
+			::operator delete(ptr, std::align_val_t(SMALL_ALIGN));
+		else
+			::operator delete(ptr, std::align_val_t(HUGE_PAGE_SIZE));
+	}
+
+	template<typename U>
+	bool operator==(const HugePageAllocator<U, THRESHOLD>&) const
+	{
+		return true;
+	}
+
+	template<typename U>
+	bool operator!=(const HugePageAllocator<U, THRESHOLD>&) const
+	{
+		return false;
+	}
+
+private:
+	constexpr static size_t SMALL_ALIGN = alignof(T) > 64 ? alignof(T) : 64;
+
+	static size_t padded(size_t bytes)
+	{
+		return (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+	}
+};
+
+}
+
+#endif // ALLOCATORS_HPP
@@ -22,9 +22,67 @@
 #include <stdexcept>
 
 /**
- * @brief Array Base class.
+ * @brief Memory layout of an array: the order of the axes in memory.
+ *
+ * @details Axes are listed from the slowest to the fastest varying one,
+ *          so {0, 1, ...} is row-major (C) order and {..., 1, 0} column-major (Fortran) order.
  */
 template<size_t NDIM>
+struct Layout
+{
+	/// Type of axis order container.
+	typedef std::array<size_t, NDIM> order_t;
+
+	/// Axes from the slowest to the fastest varying one.
+	order_t order;
+
+	/**
+	 * @brief Layout with an arbitrary axis order.
+	 *
+	 * @throws Runtime error if the order is not a permutation of the axes.
+	 */
+	explicit Layout(const order_t &order):
+		order(order)
+	{
+		std::array<bool, NDIM> seen{false};
+		for(size_t axis : order)
+		{
+			if(axis >= NDIM || seen[axis])
+				throw std::runtime_error("Layout axis order must be a permutation of the axes.");
+			seen[axis] = true;
+		}
+	}
+
+	/**
+	 * @brief Row-major (C) layout: the last axis varies fastest.
+	 */
+	static Layout rowMajor()
+	{
+		order_t order;
+		for(size_t i = 0; i < NDIM; i++)
+			order[i] = i;
+		return Layout(order);
+	}
+
+	/**
+	 * @brief Column-major (Fortran) layout: the first axis varies fastest.
+	 */
+	static Layout columnMajor()
+	{
+		order_t order;
+		for(size_t i = 0; i < NDIM; i++)
+			order[i] = NDIM - 1 - i;
+		return Layout(order);
+	}
+};
+
+/**
+ * @brief Array Base class.
+ *
+ * @details With ROW_MAJOR the strides are the dense row-major ones, so the last stride is 1
+ *          at compile time and offsets skip multiplying by it. Otherwise the strides are arbitrary.
+ */
+template<size_t NDIM, bool ROW_MAJOR = false>
 class ArrayBase
 {
 public:
@@ -35,7 +93,7 @@ public:
 	constexpr static size_t ndim = NDIM;
 
 	/// This type.
-	typedef ArrayBase<NDIM> this_t;
+	typedef ArrayBase<NDIM, ROW_MAJOR> this_t;
 	/// Type of shape container.
 	typedef std::array<size_t, NDIM> shape_t;
 
@@ -47,6 +105,24 @@ public:
 	{
 	}
 
+	// Constructor with a memory layout, to be used only by child classes.
+	ArrayBase(shape_t shape, const Layout<NDIM> &layout):
+		_size(computeSize(shape)),
+		_shape(std::move(shape)),
+		_strides(computeStrides(_shape, layout))
+	{
+		static_assert(!ROW_MAJOR, "Row-major arrays cannot take another memory layout.");
+	}
+
+	// Constructor with arbitrary strides, to be used only by child classes.
+	ArrayBase(shape_t shape, shape_t strides):
+		_size(computeSize(shape)),
+		_shape(std::move(shape)),
+		_strides(std::move(strides))
+	{
+		static_assert(!ROW_MAJOR, "Row-major arrays cannot take arbitrary strides.");
+	}
+
 	/**
 	 * @brief Virtual destructor.
 	 */
@@ -70,6 +146,25 @@ public:
 		return _shape;
 	}
 
+	/**
+	 * @brief Get array strides in number of elements.
+	 */
+	const shape_t& strides() const
+	{
+		return _strides;
+	}
+
+	/**
+	 * @brief Check if the strides are the dense row-major ones.
+	 */
+	bool isRowMajor() const
+	{
+		if constexpr (ROW_MAJOR)
+			return true;
+		else
+			return _strides == computeStrides(_shape);
+	}
+
 	/**
 	 * @brief Get dimension length.
 	 */
@@ -111,7 +206,10 @@ private:
 	template<size_t DIM>
 	size_t computeOffset(size_t idx) const
 	{
-		return idx;
+		if constexpr (ROW_MAJOR)
+			return idx;
+		else
+			return idx * _strides[DIM];
 	}
 
 	// Compute array size for a shape vector.
@@ -134,6 +232,19 @@ private:
 			strides[i - 1] = strides[i] * shape[i];
 		return strides;
 	}
+
+	// Compute dense strides for a memory layout.
+	static shape_t computeStrides(const shape_t &shape, const Layout<NDIM> &layout)
+	{
+		shape_t strides;
+		size_t stride = 1;
+		for(size_t i = NDIM; i-- > 0;)
+		{
+			strides[layout.order[i]] = stride;
+			stride *= shape[layout.order[i]];
+		}
+		return strides;
+	}
 };
 
 #endif // ARRAY_BASE_HPP
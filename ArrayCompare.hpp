@@ -0,0 +1,219 @@
+/**
+ * @file
+ *
+ * @brief Comparison of contiguous elements: exact and within tolerances.
+ *
+ * @details Exact comparison uses memcmp() for types compared by their bytes,
+ *          other types are compared in chunks without branches, which the compiler vectorizes,
+ *          stopping after the first chunk with a difference.
+ *          Approximate comparison of numbers accepts absolute, relative and ULP differences
+ *          and counts the mismatches in one pass.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef ARRAY_COMPARE_HPP
+#define ARRAY_COMPARE_HPP
+
+#include "TypeTraitUtils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace util
+{
+
+/// Number of elements compared between checks for a difference.
+constexpr size_t COMPARE_CHUNK_SIZE = 256;
+
+/**
+ * @brief Check if equal values of a type have equal bytes, e.g. integers but not floats.
+ */
+template<typename T1, typename T2>
+constexpr bool is_bitwise_comparable_v = std::is_same_v<T1, T2> && std::has_unique_object_representations_v<T1>;
+
+/**
+ * @brief Equality comparison of numbers without branches, the same as util::eq().
+ */
+template<typename T1, typename T2>
+inline bool eqNumber(T1 v1, T2 v2)
+{
+	if constexpr (all_integer<T1, T2> && !same_sign<T1, T2>)
+	{
+		typedef std::make_unsigned_t<std::common_type_t<T1, T2>> unsigned_t;
+
+		// & instead of && as in eq_int()
+		if constexpr (std::is_signed_v<T1>)
+			return (v1 >= 0) & (static_cast<unsigned_t>(v1) == static_cast<unsigned_t>(v2));
+		else
+			return (v2 >= 0) & (static_cast<unsigned_t>(v1) == static_cast<unsigned_t>(v2));
+	}
+	else
+		return eq(v1, v2);
+}
+
+/**
+ * @brief Compare contiguous elements with util::eq(), stopping at the first chunk with a difference.
+ */
+template<typename T1, typename T2>
+bool equalRange(const T1 *data1, const T2 *data2, size_t size)
+{
+	if constexpr (is_bitwise_comparable_v<T1, T2>)
+		return !size || std::memcmp(data1, data2, size * sizeof(T1)) == 0;
+	else if constexpr (std::is_arithmetic_v<T1> && std::is_arithmetic_v<T2>)
+	{
+		for(size_t first = 0; first < size; first += COMPARE_CHUNK_SIZE)
+		{
+			const size_t last = std::min(first + COMPARE_CHUNK_SIZE, size);
+
+			// & instead of && keeps the loop free of branches
+			unsigned equal = 1;
+			for(size_t i = first; i < last; i++)
+				equal &= eqNumber(data1[i], data2[i]);
+
+			if(!equal)
+				return false;
+		}
+		return true;
+	}
+	else
+	{
+		size_t i = 0;
+		for(; i < size && eq(data1[i], data2[i]); i++);
+		return i == size;
+	}
+}
+
+// Unsigned integer of the size of a floating point type.
+template<typename T>
+using float_bits_t = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+// Map the sign-magnitude representation of a floating point number to ordered unsigned integers.
+template<typename T>
+inline float_bits_t<T> orderedBits(T v)
+{
+	static_assert(std::is_floating_point_v<T> && (sizeof(T) == 4 || sizeof(T) == 8),
+			"ULP distance is defined for float and double.");
+
+	typedef std::make_signed_t<float_bits_t<T>> int_t;
+
+	int_t bits;
+	std::memcpy(&bits, &v, sizeof(T));
+	return static_cast<float_bits_t<T>>(bits < 0 ? std::numeric_limits<int_t>::min() - bits : bits) ^
+			(float_bits_t<T>(1) << (8 * sizeof(T) - 1));
+}
+
+/**
+ * @brief Distance of floating point numbers in units in the last place.
+ *
+ * @details The number of representable values between them, 0 for +0 and -0.
+ *          NaNs are at the maximum distance from everything.
+ */
+template<typename T>
+uint64_t ulpDistance(T v1, T v2)
+{
+	const float_bits_t<T> i1 = orderedBits(v1);
+	const float_bits_t<T> i2 = orderedBits(v2);
+
+	return std::isnan(v1) || std::isnan(v2) ? std::numeric_limits<uint64_t>::max() : i1 < i2 ? i2 - i1 : i1 - i2;
+}
+
+/**
+ * @brief Check if numbers are close.
+ *
+ * @details Numbers are close if they are equal, or their difference is at most absTol,
+ *          or at most relTol times the larger magnitude, or at most maxUlps representable values apart.
+ *          NaNs are never close. Floating point numbers of mixed precision are compared in the lower one.
+ */
+template<typename T1, typename T2>
+inline bool approxEq(T1 v1, T2 v2, double absTol, double relTol, uint64_t maxUlps)
+{
+	typedef std::conditional_t<std::is_floating_point_v<T1> && std::is_floating_point_v<T2>,
+			std::conditional_t<(sizeof(T1) < sizeof(T2)), T1, T2>, double> real_t;
+
+	const real_t r1 = static_cast<real_t>(v1);
+	const real_t r2 = static_cast<real_t>(v2);
+	const real_t diff = std::abs(r1 - r2);
+	const real_t magnitude = std::max(std::abs(r1), std::abs(r2));
+
+	// | instead of || keeps the comparison free of branches
+	bool result = (r1 == r2) | (diff <= static_cast<real_t>(absTol)) |
+			(diff <= static_cast<real_t>(relTol) * magnitude);
+	if constexpr (std::is_floating_point_v<T1> && std::is_floating_point_v<T2>)
+	{
+		// the distance in the integer size of the numbers, so the comparison vectorizes
+		typedef float_bits_t<real_t> bits_t;
+		const bits_t ulps = static_cast<bits_t>(std::min<uint64_t>(maxUlps, std::numeric_limits<bits_t>::max()));
+
+		const bits_t i1 = orderedBits(r1);
+		const bits_t i2 = orderedBits(r2);
+		result |= ((i1 < i2 ? i2 - i1 : i1 - i2) <= ulps) & (r1 == r1) & (r2 == r2);
+	}
+	return result;
+}
+
+/**
+ * @brief Result of approximate comparison.
+ */
+template<size_t NDIM>
+struct ApproxComparison
+{
+	/// Number of elements not close.
+	size_t mismatches = 0;
+	/// Indexes of the first element not close, valid if there are mismatches.
+	std::array<size_t, NDIM> firstMismatch{};
+
+	/**
+	 * @brief True if all elements are close.
+	 */
+	explicit operator bool() const
+	{
+		return !mismatches;
+	}
+};
+
+/**
+ * @brief Count contiguous elements which are not close, see approxEq(), and find the first one.
+ *
+ * @details Chunks are counted without branches, a chunk with mismatches
+ *          is searched for the first one only while none was found.
+ *
+ * @returns Number of mismatches, first is set to the offset of the first one.
+ */
+template<typename T1, typename T2>
+size_t countMismatches(const T1 *data1, const T2 *data2, size_t size,
+					   double absTol, double relTol, uint64_t maxUlps, size_t &first)
+{
+	size_t mismatches = 0;
+
+	for(size_t begin = 0; begin < size; begin += COMPARE_CHUNK_SIZE)
+	{
+		const size_t end = std::min(begin + COMPARE_CHUNK_SIZE, size);
+
+		unsigned count = 0;
+		for(size_t i = begin; i < end; i++)
+			count += !approxEq(data1[i], data2[i], absTol, relTol, maxUlps);
+
+		if(count && !mismatches)
+			for(first = begin; approxEq(data1[first], data2[first], absTol, relTol, maxUlps); first++);
+
+		mismatches += count;
+	}
+
+	return mismatches;
+}
+
+}
+
+#endif // ARRAY_COMPARE_HPP
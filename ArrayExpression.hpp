@@ -0,0 +1,508 @@
+/**
+ * @file
+ *
+ * @brief Lazy element-wise array expressions.
+ *
+ * @details Arithmetic operators and math functions on array views build expression templates
+ *          instead of computing temporary arrays. Copying an expression into a view with operator<<
+ *          evaluates it in a single pass over memory, a flat loop when all arrays share the layout.
+ *          Operands of different shapes are broadcast as in NumPy, e.g. a 4D array times
+ *          a 1D array of per-channel scales, without expanding the smaller operand in memory.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef ARRAY_EXPRESSION_HPP
+#define ARRAY_EXPRESSION_HPP
+
+#include "BasicArrayView.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+
+namespace util
+{
+
+/// Absolute value functor.
+struct Abs
+{
+	template<typename V>
+	auto operator()(const V &v) const { using std::abs; return abs(v); }
+};
+
+/// Square root functor.
+struct Sqrt
+{
+	template<typename V>
+	auto operator()(const V &v) const { using std::sqrt; return sqrt(v); }
+};
+
+/// Exponential functor.
+struct Exp
+{
+	template<typename V>
+	auto operator()(const V &v) const { using std::exp; return exp(v); }
+};
+
+/// Natural logarithm functor.
+struct Log
+{
+	template<typename V>
+	auto operator()(const V &v) const { using std::log; return log(v); }
+};
+
+/// Sine functor.
+struct Sin
+{
+	template<typename V>
+	auto operator()(const V &v) const { using std::sin; return sin(v); }
+};
+
+/// Cosine functor.
+struct Cos
+{
+	template<typename V>
+	auto operator()(const V &v) const { using std::cos; return cos(v); }
+};
+
+}
+
+/**
+ * @brief Array view operand of an expression.
+ *
+ * @details Holds the data pointer, shape and strides, not the view itself,
+ *          so expressions can be built from temporary views, e.g. slices.
+ *          Dimensions of length 1 get zero strides, so the operand can be broadcast.
+ *          Indexes with more dimensions than the operand are aligned at the end.
+ */
+template<typename T, size_t NDIM>
+class ArrayOperand
+{
+public:
+
+	/// Number of dimensions.
+	constexpr static size_t ndim = NDIM;
+	/// Type of shape container.
+	typedef std::array<size_t, NDIM> shape_t;
+	/// Value type.
+	typedef std::remove_const_t<T> value_type;
+
+	/**
+	 * @brief Operand of a view with a data pointer and strides.
+	 */
+	template<typename VIEW>
+	explicit ArrayOperand(const VIEW &view):
+		_data(&*view.begin()),
+		_shape(view.shape()),
+		_strides(view.strides())
+	{
+		for(size_t dim = 0; dim < NDIM; dim++)
+		{
+			if(_shape[dim] == 1)
+				_strides[dim] = 0;
+		}
+	}
+
+	const shape_t& shape() const
+	{
+		return _shape;
+	}
+
+	/**
+	 * @brief Check if flat offsets of data with the shape and strides address the same elements.
+	 */
+	template<size_t ONDIM>
+	bool hasLayout(const std::array<size_t, ONDIM> &shape, const std::array<size_t, ONDIM> &strides) const
+	{
+		if constexpr (ONDIM != NDIM)
+			return false;
+		else
+		{
+			if(shape != _shape)
+				return false;
+
+			for(size_t dim = 0; dim < NDIM; dim++)
+			{
+				if(_shape[dim] != 1 && _strides[dim] != strides[dim])
+					return false;
+			}
+			return true;
+		}
+	}
+
+	value_type operator[](size_t offset) const
+	{
+		return _data[offset];
+	}
+
+	template<size_t ONDIM>
+	value_type at(const std::array<size_t, ONDIM> &idx) const
+	{
+		static_assert(ONDIM >= NDIM, "Index must have at least the number of dimensions of the operand.");
+
+		size_t offset = 0;
+		for(size_t dim = 0; dim < NDIM; dim++)
+			offset += idx[dim + ONDIM - NDIM] * _strides[dim];
+		return _data[offset];
+	}
+
+private:
+	const T *_data;
+	shape_t _shape;
+	shape_t _strides;
+};
+
+/**
+ * @brief Scalar operand of an expression, the same for all elements.
+ */
+template<typename T>
+class ScalarOperand
+{
+public:
+
+	/// Number of dimensions: none.
+	constexpr static size_t ndim = 0;
+	/// Value type.
+	typedef T value_type;
+
+	explicit ScalarOperand(T value):
+		_value(value)
+	{
+	}
+
+	template<typename SHAPE>
+	bool hasLayout(const SHAPE&, const SHAPE&) const
+	{
+		return true;
+	}
+
+	value_type operator[](size_t) const
+	{
+		return _value;
+	}
+
+	template<typename SHAPE>
+	value_type at(const SHAPE&) const
+	{
+		return _value;
+	}
+
+private:
+	T _value;
+};
+
+/**
+ * @brief Unary element-wise expression, e.g. a negation or a math function.
+ */
+template<typename OP, typename E>
+class UnaryExpression
+{
+public:
+
+	/// Number of dimensions.
+	constexpr static size_t ndim = E::ndim;
+	/// Type of shape container.
+	typedef std::array<size_t, ndim> shape_t;
+	/// Value type.
+	typedef decltype(OP()(std::declval<typename E::value_type>())) value_type;
+
+	explicit UnaryExpression(const E &operand):
+		_operand(operand)
+	{
+	}
+
+	const shape_t& shape() const
+	{
+		return _operand.shape();
+	}
+
+	template<typename SHAPE>
+	bool hasLayout(const SHAPE &shape, const SHAPE &strides) const
+	{
+		return _operand.hasLayout(shape, strides);
+	}
+
+	value_type operator[](size_t offset) const
+	{
+		return OP()(_operand[offset]);
+	}
+
+	template<typename SHAPE>
+	value_type at(const SHAPE &idx) const
+	{
+		return OP()(_operand.at(idx));
+	}
+
+private:
+	const E _operand;
+};
+
+/**
+ * @brief Binary element-wise expression of arrays and scalars.
+ *
+ * @details Both operands are converted to util::common_number_t before the operation,
+ *          so mixing signed and unsigned integers does not wrap negative values around.
+ *          Array operands of different shapes are broadcast to a common shape.
+ *
+ * @throws Runtime error on construction if the array operand shapes cannot be broadcast.
+ */
+template<typename OP, typename L, typename R>
+class BinaryExpression
+{
+public:
+
+	/// Number of dimensions.
+	constexpr static size_t ndim = std::max(L::ndim, R::ndim);
+	/// Type of shape container.
+	typedef std::array<size_t, ndim> shape_t;
+	/// Type the operands are converted to.
+	typedef util::common_number_t<typename L::value_type, typename R::value_type> operand_t;
+	/// Value type.
+	typedef decltype(OP()(std::declval<operand_t>(), std::declval<operand_t>())) value_type;
+
+	BinaryExpression(const L &left, const R &right):
+		_left(left),
+		_right(right),
+		_shape(commonShape(left, right))
+	{
+	}
+
+	const shape_t& shape() const
+	{
+		return _shape;
+	}
+
+	template<typename SHAPE>
+	bool hasLayout(const SHAPE &shape, const SHAPE &strides) const
+	{
+		return _left.hasLayout(shape, strides) && _right.hasLayout(shape, strides);
+	}
+
+	value_type operator[](size_t offset) const
+	{
+		return OP()(static_cast<operand_t>(_left[offset]), static_cast<operand_t>(_right[offset]));
+	}
+
+	template<typename SHAPE>
+	value_type at(const SHAPE &idx) const
+	{
+		return OP()(static_cast<operand_t>(_left.at(idx)), static_cast<operand_t>(_right.at(idx)));
+	}
+
+private:
+	const L _left;
+	const R _right;
+	const shape_t _shape;
+
+	static shape_t commonShape(const L &left, const R &right)
+	{
+		if constexpr (!L::ndim)
+			return right.shape();
+		else if constexpr (!R::ndim)
+			return left.shape();
+		else
+			return broadcastShape(left.shape(), right.shape());
+	}
+};
+
+/**
+ * @brief Check if a type can be an array operand of an expression.
+ */
+template<typename T>
+constexpr bool is_expression_operand_v = is_array_expression_v<T> || is_strided_view_v<T>;
+
+// Expression operand types of scalars, expressions and views.
+template<typename T, typename = void>
+struct expression_operand
+{
+	typedef ScalarOperand<T> type;
+};
+
+template<typename T>
+struct expression_operand<T, std::enable_if_t<is_array_expression_v<T>>>
+{
+	typedef T type;
+};
+
+template<typename T>
+struct expression_operand<T, std::enable_if_t<is_strided_view_v<T>>>
+{
+	typedef ArrayOperand<typename T::data_t, T::ndim> type;
+};
+
+template<typename T>
+using operand_t = typename expression_operand<T>::type;
+
+// Wrap a scalar, an expression or a view as an expression operand.
+template<typename T>
+operand_t<T> toOperand(const T &value)
+{
+	return operand_t<T>(value);
+}
+
+/**
+ * @brief Check if types can be operands of a binary expression: one array and an array or a scalar.
+ */
+template<typename T1, typename T2>
+constexpr bool is_binary_expression_v =
+		(is_expression_operand_v<T1> && (is_expression_operand_v<T2> || std::is_arithmetic_v<T2>)) ||
+		(std::is_arithmetic_v<T1> && is_expression_operand_v<T2>);
+
+/**
+ * @brief Element-wise addition.
+ */
+template<typename T1, typename T2>
+std::enable_if_t<is_binary_expression_v<T1, T2>, BinaryExpression<std::plus<>, operand_t<T1>, operand_t<T2>>>
+operator+(const T1 &left, const T2 &right)
+{
+	return {toOperand(left), toOperand(right)};
+}
+
+/**
+ * @brief Element-wise subtraction.
+ */
+template<typename T1, typename T2>
+std::enable_if_t<is_binary_expression_v<T1, T2>, BinaryExpression<std::minus<>, operand_t<T1>, operand_t<T2>>>
+operator-(const T1 &left, const T2 &right)
+{
+	return {toOperand(left), toOperand(right)};
+}
+
+/**
+ * @brief Element-wise multiplication.
+ */
+template<typename T1, typename T2>
+std::enable_if_t<is_binary_expression_v<T1, T2>, BinaryExpression<std::multiplies<>, operand_t<T1>, operand_t<T2>>>
+operator*(const T1 &left, const T2 &right)
+{
+	return {toOperand(left), toOperand(right)};
+}
+
+/**
+ * @brief Element-wise division.
+ */
+template<typename T1, typename T2>
+std::enable_if_t<is_binary_expression_v<T1, T2>, BinaryExpression<std::divides<>, operand_t<T1>, operand_t<T2>>>
+operator/(const T1 &left, const T2 &right)
+{
+	return {toOperand(left), toOperand(right)};
+}
+
+/**
+ * @brief Element-wise negation.
+ */
+template<typename T>
+std::enable_if_t<is_expression_operand_v<T>, UnaryExpression<std::negate<>, operand_t<T>>>
+operator-(const T &operand)
+{
+	return UnaryExpression<std::negate<>, operand_t<T>>(toOperand(operand));
+}
+
+/**
+ * @brief Element-wise absolute value.
+ */
+template<typename T>
+std::enable_if_t<is_expression_operand_v<T>, UnaryExpression<util::Abs, operand_t<T>>>
+abs(const T &operand)
+{
+	return UnaryExpression<util::Abs, operand_t<T>>(toOperand(operand));
+}
+
+/**
+ * @brief Element-wise square root.
+ */
+template<typename T>
+std::enable_if_t<is_expression_operand_v<T>, UnaryExpression<util::Sqrt, operand_t<T>>>
+sqrt(const T &operand)
+{
+	return UnaryExpression<util::Sqrt, operand_t<T>>(toOperand(operand));
+}
+
+/**
+ * @brief Element-wise exponential.
+ */
+template<typename T>
+std::enable_if_t<is_expression_operand_v<T>, UnaryExpression<util::Exp, operand_t<T>>>
+exp(const T &operand)
+{
+	return UnaryExpression<util::Exp, operand_t<T>>(toOperand(operand));
+}
+
+/**
+ * @brief Element-wise natural logarithm.
+ */
+template<typename T>
+std::enable_if_t<is_expression_operand_v<T>, UnaryExpression<util::Log, operand_t<T>>>
+log(const T &operand)
+{
+	return UnaryExpression<util::Log, operand_t<T>>(toOperand(operand));
+}
+
+/**
+ * @brief Element-wise sine.
+ */
+template<typename T>
+std::enable_if_t<is_expression_operand_v<T>, UnaryExpression<util::Sin, operand_t<T>>>
+sin(const T &operand)
+{
+	return UnaryExpression<util::Sin, operand_t<T>>(toOperand(operand));
+}
+
+/**
+ * @brief Element-wise cosine.
+ */
+template<typename T>
+std::enable_if_t<is_expression_operand_v<T>, UnaryExpression<util::Cos, operand_t<T>>>
+cos(const T &operand)
+{
+	return UnaryExpression<util::Cos, operand_t<T>>(toOperand(operand));
+}
+
+/**
+ * @brief Evaluate an expression into strided data of the same shape.
+ *
+ * @details A flat loop when the data is dense and all array operands have its shape and strides,
+ *          otherwise a traversal of the indexes.
+ *          An expression of a smaller shape is broadcast to the shape of the data.
+ *          Each element is written after reading the elements at the same indexes,
+ *          so the data may be an operand only at the same strides, not e.g. transposed.
+ *
+ * @throws Runtime error if the expression cannot be broadcast to the shape.
+ */
+template<typename T, size_t NDIM, typename EXPR>
+void assignExpression(T *data, const std::array<size_t, NDIM> &shape, const std::array<size_t, NDIM> &strides,
+					  bool dense, const EXPR &expr)
+{
+	static_assert(EXPR::ndim <= NDIM, "Expression cannot have more dimensions than the array.");
+
+	if(broadcastShape(shape, expr.shape()) != shape)
+		throw std::runtime_error("Cannot assign expression: array shapes do not match.");
+
+	if(dense && expr.hasLayout(shape, strides))
+	{
+		size_t size = 1;
+		for(size_t dimLen : shape)
+			size *= dimLen;
+
+		for(size_t i = 0; i < size; i++)
+			data[i] = static_cast<T>(expr[i]);
+	}
+	else
+	{
+		BasicArrayTraversal<T*, NDIM>(data, std::array<size_t, NDIM>{0}, shape, strides).
+				traverse([&expr](const std::array<size_t, NDIM> &idx, T &value)
+		{
+			value = static_cast<T>(expr.at(idx));
+		});
+	}
+}
+
+#endif // ARRAY_EXPRESSION_HPP
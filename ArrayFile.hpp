@@ -0,0 +1,395 @@
+/**
+ * @file
+ *
+ * @brief Binary array files.
+ *
+ * @details Arrays are stored in the NumPy .npy format (version 1.0, or 2.0 for long headers):
+ *          a magic string, a text header with the element type, byte order and shape,
+ *          followed by the raw elements in row-major order.
+ *          The files can be loaded directly with numpy.load() or memory-mapped.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef ARRAY_FILE_HPP
+#define ARRAY_FILE_HPP
+
+#include "BasicArrayView.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace util
+{
+
+/// Byte order character of the native element representation.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr char NATIVE_BYTE_ORDER = '>';
+#else
+constexpr char NATIVE_BYTE_ORDER = '<';
+#endif
+
+template<typename T>
+struct is_complex: std::false_type {};
+
+template<typename T>
+struct is_complex<std::complex<T>>: std::true_type {};
+
+/**
+ * @brief Get the .npy type kind character of an element type.
+ */
+template<typename T>
+constexpr char npyKind()
+{
+	if constexpr (std::is_same_v<T, bool>)
+		return 'b';
+	else if constexpr (std::is_integral_v<T>)
+		return std::is_signed_v<T> ? 'i' : 'u';
+	else if constexpr (std::is_floating_point_v<T>)
+		return 'f';
+	else
+	{
+		static_assert(is_complex<T>::value, "Array file elements must be arithmetic or complex.");
+		return 'c';
+	}
+}
+
+/**
+ * @brief Get the .npy type description of an element type, e.g. "<f4".
+ */
+template<typename T>
+std::string npyDescr()
+{
+	return std::string(1, sizeof(T) == 1 ? '|' : NATIVE_BYTE_ORDER) + npyKind<T>() + std::to_string(sizeof(T));
+}
+
+/**
+ * @brief Reverse the bytes of each element in place.
+ */
+template<typename T>
+void swapBytes(T *data, size_t size)
+{
+	// complex numbers swap each part
+	constexpr size_t partSize = is_complex<T>::value ? sizeof(T) / 2 : sizeof(T);
+
+	char *bytes = reinterpret_cast<char*>(data);
+	char *const bytesEnd = bytes + size * sizeof(T);
+	for(; bytes != bytesEnd; bytes += partSize)
+		std::reverse(bytes, bytes + partSize);
+}
+
+}
+
+/**
+ * @brief Streaming writer of an array file.
+ *
+ * @details The header is written on construction, the data is written slab by slab
+ *          along dimension 0, so the whole array never has to be held in memory.
+ *          Slabs go straight from the array buffer to the file.
+ */
+template<typename T, size_t NDIM>
+class ArrayWriter final
+{
+public:
+
+	/// Type of shape container.
+	typedef typename ArrayBase<NDIM>::shape_t shape_t;
+
+	/**
+	 * @brief Create the file and write the header of an array with the given shape.
+	 *
+	 * @throws Runtime error if the file cannot be written.
+	 */
+	ArrayWriter(const std::string &path, const shape_t &shape):
+		_path(path),
+		_shape(shape),
+		_rows(0),
+		_file(path, std::ios::binary | std::ios::trunc)
+	{
+		if(!_file)
+			throw std::runtime_error("Cannot create file " + path);
+
+		std::string dict = "{'descr': '" + util::npyDescr<T>() + "', 'fortran_order': False, 'shape': (";
+		for(size_t dimLen : shape)
+			dict += std::to_string(dimLen) + ", ";
+		if(NDIM > 1)
+			dict.resize(dict.size() - 2);
+		else
+			dict.pop_back();
+		dict += "), }";
+
+		// version 1.0 stores the header length in 2 bytes, 2.0 in 4 bytes
+		const bool longHeader = dict.size() + 1 + 10 > 0xffff;
+		const size_t preludeSize = longHeader ? 12 : 10;
+
+		// pad with spaces and end with a new line, so the data is aligned to 64 bytes
+		const size_t headerSize = (preludeSize + dict.size() + 1 + 63) / 64 * 64 - preludeSize;
+		dict.resize(headerSize - 1, ' ');
+		dict += '\n';
+
+		std::string prelude = "\x93NUMPY";
+		prelude += static_cast<char>(longHeader ? 2 : 1);
+		prelude += '\0';
+		for(size_t i = 0; i < preludeSize - 8; i++)
+			prelude += static_cast<char>((headerSize >> (8 * i)) & 0xff);
+
+		_file << prelude << dict;
+		check();
+	}
+
+	ArrayWriter(const ArrayWriter&) = delete;
+	ArrayWriter& operator=(const ArrayWriter&) = delete;
+
+	/**
+	 * @brief Append a slab of rows along dimension 0.
+	 *
+	 * @details All dimensions but 0 must match the array shape.
+	 *          The slab must have the row-major layout.
+	 *
+	 * @throws Runtime error if the slab does not fit or writing fails.
+	 */
+	template<typename ST>
+	std::enable_if_t<std::is_same_v<std::remove_const_t<ST>, T>, ArrayWriter&>
+	write(const BasicArrayView<ST, NDIM> &slab)
+	{
+		if(!std::equal(_shape.begin() + 1, _shape.end(), slab.shape().begin() + 1))
+			throw std::runtime_error("Slab shape does not match the array shape in file " + _path);
+
+		if(_rows + slab.template dim<0>() > _shape[0])
+			throw std::runtime_error("Too many rows written to file " + _path);
+
+		_file.write(reinterpret_cast<const char*>(slab.begin()), slab.size() * sizeof(T));
+		check();
+
+		_rows += slab.template dim<0>();
+		return *this;
+	}
+
+	/**
+	 * @brief Number of rows along dimension 0 written so far.
+	 */
+	size_t rows() const
+	{
+		return _rows;
+	}
+
+	/**
+	 * @brief Flush and close the file.
+	 *
+	 * @throws Runtime error if not all rows were written or writing fails.
+	 */
+	void close()
+	{
+		if(_rows != _shape[0])
+			throw std::runtime_error("Not all rows written to file " + _path);
+
+		_file.close();
+		check();
+	}
+
+private:
+	const std::string _path;
+	const shape_t _shape;
+	size_t _rows;
+	std::ofstream _file;
+
+	void check() const
+	{
+		if(!_file)
+			throw std::runtime_error("Cannot write file " + _path);
+	}
+};
+
+/**
+ * @brief Streaming reader of an array file.
+ *
+ * @details The header is read and checked on construction, the data is read slab by slab
+ *          along dimension 0 straight into the array buffer.
+ *          Data of the other byte order is swapped in place after reading.
+ */
+template<typename T, size_t NDIM>
+class ArrayReader final
+{
+public:
+
+	/// Type of shape container.
+	typedef typename ArrayBase<NDIM>::shape_t shape_t;
+
+	/**
+	 * @brief Open the file and read the header.
+	 *
+	 * @throws Runtime error if the file cannot be read or does not hold
+	 *         a row-major array of the element type and number of dimensions.
+	 */
+	explicit ArrayReader(const std::string &path):
+		_path(path),
+		_rows(0),
+		_file(path, std::ios::binary)
+	{
+		if(!_file)
+			throw std::runtime_error("Cannot open file " + path);
+
+		char prelude[12];
+		_file.read(prelude, 8);
+		check();
+		if(std::memcmp(prelude, "\x93NUMPY", 6) != 0)
+			throw std::runtime_error("Not an array file " + path);
+
+		const size_t preludeSize = prelude[6] == 1 ? 10 : 12;
+		_file.read(prelude + 8, preludeSize - 8);
+		check();
+
+		size_t headerSize = 0;
+		for(size_t i = preludeSize - 1; i >= 8; i--)
+			headerSize = headerSize << 8 | static_cast<unsigned char>(prelude[i]);
+
+		std::string dict(headerSize, '\0');
+		_file.read(dict.data(), headerSize);
+		check();
+
+		_dataOffset = preludeSize + headerSize;
+
+		// element type, e.g. '<f4'
+		const std::string descr = value(dict, "descr");
+		const std::string expected = util::npyDescr<T>();
+		if(descr.size() != expected.size() + 2 || descr.compare(2, expected.size() - 1, expected, 1) != 0)
+			throw std::runtime_error("Element type " + descr + " does not match " + expected + " in file " + path);
+		_swap = sizeof(T) > 1 && descr[1] != '|' && descr[1] != '=' && descr[1] != util::NATIVE_BYTE_ORDER;
+
+		if(value(dict, "fortran_order").compare(0, 5, "False") != 0)
+			throw std::runtime_error("Column-major order is not supported in file " + path);
+
+		// shape, e.g. (10, 20)
+		const std::string shape = value(dict, "shape");
+		size_t dim = 0;
+		for(size_t pos = shape.find_first_of("0123456789"); pos != std::string::npos;
+				pos = shape.find_first_of("0123456789", pos))
+		{
+			if(dim == NDIM)
+				throw std::runtime_error("Too many dimensions in file " + path);
+			size_t len;
+			_shape[dim++] = std::stoul(shape.substr(pos), &len);
+			pos += len;
+		}
+		if(dim != NDIM)
+			throw std::runtime_error("Too few dimensions in file " + path);
+	}
+
+	ArrayReader(const ArrayReader&) = delete;
+	ArrayReader& operator=(const ArrayReader&) = delete;
+
+	/**
+	 * @brief Get the array shape stored in the file.
+	 */
+	const shape_t& shape() const
+	{
+		return _shape;
+	}
+
+	/**
+	 * @brief Get the byte offset of the data in the file, e.g. for memory mapping.
+	 */
+	size_t dataOffset() const
+	{
+		return _dataOffset;
+	}
+
+	/**
+	 * @brief Number of rows along dimension 0 read so far.
+	 */
+	size_t rows() const
+	{
+		return _rows;
+	}
+
+	/**
+	 * @brief Read the next slab of rows along dimension 0.
+	 *
+	 * @details All dimensions but 0 must match the array shape.
+	 *          The slab must have the row-major layout.
+	 *          Read the whole array with a slab of the full shape.
+	 *
+	 * @throws Runtime error if the slab does not fit or reading fails.
+	 */
+	ArrayReader& read(BasicArrayView<T, NDIM> &slab)
+	{
+		if(!std::equal(_shape.begin() + 1, _shape.end(), slab.shape().begin() + 1))
+			throw std::runtime_error("Slab shape does not match the array shape in file " + _path);
+
+		if(_rows + slab.template dim<0>() > _shape[0])
+			throw std::runtime_error("Too many rows read from file " + _path);
+
+		_file.read(reinterpret_cast<char*>(slab.begin()), slab.size() * sizeof(T));
+		check();
+
+		if(_swap)
+			util::swapBytes(slab.begin(), slab.size());
+
+		_rows += slab.template dim<0>();
+		return *this;
+	}
+
+private:
+	const std::string _path;
+	shape_t _shape;
+	size_t _dataOffset;
+	size_t _rows;
+	bool _swap;
+	std::ifstream _file;
+
+	void check() const
+	{
+		if(!_file)
+			throw std::runtime_error("Cannot read file " + _path);
+	}
+
+	// Get the text of a header value after the key.
+	std::string value(const std::string &dict, const std::string &key) const
+	{
+		const size_t pos = dict.find("'" + key + "':");
+		if(pos == std::string::npos)
+			throw std::runtime_error("No " + key + " in the header of file " + _path);
+
+		const size_t begin = dict.find_first_not_of(' ', pos + key.size() + 3);
+		return dict.substr(begin, dict.find_first_of(",}", dict[begin] == '(' ? dict.find(')', begin) : begin) - begin);
+	}
+};
+
+/**
+ * @brief Save an array to a file.
+ *
+ * @throws Runtime error if the file cannot be written.
+ */
+template<typename T, size_t NDIM>
+void saveArray(const std::string &path, const BasicArrayView<T, NDIM> &array)
+{
+	ArrayWriter<std::remove_const_t<T>, NDIM> writer(path, array.shape());
+	writer.write(array);
+	writer.close();
+}
+
+/**
+ * @brief Load an array of the same shape from a file.
+ *
+ * @throws Runtime error if the file cannot be read or its array does not match.
+ */
+template<typename T, size_t NDIM>
+void loadArray(const std::string &path, BasicArrayView<T, NDIM> &array)
+{
+	ArrayReader<T, NDIM> reader(path);
+	if(reader.shape() != array.shape())
+		throw std::runtime_error("Array shape does not match the shape in file " + path);
+	reader.read(array);
+}
+
+#endif // ARRAY_FILE_HPP
@@ -18,54 +18,322 @@
 #ifndef BASIC_ARRAY_HPP
 #define BASIC_ARRAY_HPP
 
+#include "Allocators.hpp"
 #include "BasicArrayView.hpp"
 #include "ClonableBase.hpp"
 
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
 #include <vector>
 
+/// Default number of bytes of elements stored inline in a basic array, e.g. a 4x4 matrix of doubles.
+constexpr size_t BASIC_ARRAY_INLINE_BYTES = 128;
+
+namespace util
+{
+
+/**
+ * @brief Inline storage for up to CAPACITY elements, empty without capacity.
+ */
+template<typename T, size_t CAPACITY>
+class InlineStorage
+{
+protected:
+	T* inlineData()
+	{
+		return std::launder(reinterpret_cast<T*>(_bytes));
+	}
+
+	const T* inlineData() const
+	{
+		return std::launder(reinterpret_cast<const T*>(_bytes));
+	}
+
+private:
+	alignas(T) unsigned char _bytes[CAPACITY * sizeof(T)];
+};
+
+template<typename T>
+class InlineStorage<T, 0>
+{
+protected:
+	T* inlineData()
+	{
+		return nullptr;
+	}
+
+	const T* inlineData() const
+	{
+		return nullptr;
+	}
+};
+
+}
+
 /**
  * @brief Basic (contiguous) array.
  *
  * @details A contiguous array container and functionality.
+ *          Storage is allocated via the allocator ALLOC, except for arrays of trivially copyable types
+ *          of at most INLINE_BYTES, which keep their elements inline in the object without allocating.
+ *          Row-major, or without ROW_MAJOR in any memory layout, see LayoutArray.
  *          Clonable.
  */
-template<typename T, size_t NDIM>
+template<typename T, size_t NDIM, typename ALLOC = std::allocator<T>, size_t INLINE_BYTES = BASIC_ARRAY_INLINE_BYTES,
+		 bool ROW_MAJOR = true>
 class BasicArray final:
-	public BasicArrayView<T, NDIM>,
-	public ClonableBase<BasicArray<T, NDIM>>
+	public BasicArrayView<T, NDIM, ROW_MAJOR>,
+	public ClonableBase<BasicArray<T, NDIM, ALLOC, INLINE_BYTES, ROW_MAJOR>>,
+	private util::InlineStorage<T, std::is_trivially_copyable_v<T> ? INLINE_BYTES / sizeof(T) : 0>
 {
 public:
 
 	/// This type.
-	typedef BasicArray<T, NDIM> this_t;
+	typedef BasicArray<T, NDIM, ALLOC, INLINE_BYTES, ROW_MAJOR> this_t;
 	/// Base type.
-	typedef BasicArrayView<T, NDIM> base_t;
+	typedef BasicArrayView<T, NDIM, ROW_MAJOR> base_t;
 	/// Type of shape container.
 	typedef typename base_t::shape_t shape_t;
+	/// Allocator type.
+	typedef ALLOC allocator_type;
+
+	/// Maximum number of elements stored inline.
+	constexpr static size_t INLINE_CAPACITY = std::is_trivially_copyable_v<T> ? INLINE_BYTES / sizeof(T) : 0;
 
 	/**
 	 * @brief Constructors which initializes with default value.
 	 */
-	BasicArray(shape_t shape):
-		base_t(std::move(shape)),
-		_container(this->size())
+	BasicArray(shape_t shape, const ALLOC &alloc = ALLOC()):
+		BasicArray(std::move(shape), T(), alloc)
 	{
-		this->_data = _container.data();
 	}
 
 	/**
 	 * @brief Constructors which initializes with provided value.
 	 */
-	BasicArray(shape_t shape, const T &value):
+	BasicArray(shape_t shape, const T &value, const ALLOC &alloc = ALLOC()):
 		base_t(std::move(shape)),
-		_container(this->size(), value)
+		_container(containerSize(this->size()), value, alloc)
+	{
+		bind();
+		if(isInline())
+			std::uninitialized_fill_n(this->_data, this->_size, value);
+	}
+
+	/**
+	 * @brief Constructors with a memory layout, e.g. column-major, which initializes with provided value.
+	 *
+	 * @details For arrays without ROW_MAJOR.
+	 */
+	BasicArray(shape_t shape, const Layout<NDIM> &layout, const T &value = T(), const ALLOC &alloc = ALLOC()):
+		base_t(std::move(shape), layout),
+		_container(containerSize(this->size()), value, alloc)
+	{
+		bind();
+		if(isInline())
+			std::uninitialized_fill_n(this->_data, this->_size, value);
+	}
+
+	/**
+	 * @brief Constructors which leaves elements of trivial types uninitialized.
+	 *
+	 * @details Non-trivial types are default constructed.
+	 *          Saves a pass over memory when all elements are written next anyway.
+	 */
+	BasicArray(shape_t shape, util::uninitialized_t, const ALLOC &alloc = ALLOC()):
+		base_t(std::move(shape)),
+		_container(containerSize(this->size()), alloc)
+	{
+		bind();
+		if(isInline())
+			std::uninitialized_default_construct_n(this->_data, this->_size);
+	}
+
+	/**
+	 * @brief Constructors which initializes with provided value in parallel.
+	 *
+	 * @details Memory pages of trivial types are first touched by the pool threads
+	 *          with the same partitioning as traverseParallel(), so on NUMA systems
+	 *          they land on the nodes of the threads which later process them
+	 *          if the pool workers are pinned and no chunks are stolen, see ThreadPool.
+	 */
+	BasicArray(shape_t shape, const T &value, util::ThreadPool &pool, const ALLOC &alloc = ALLOC()):
+		BasicArray(std::move(shape), util::uninitialized, alloc)
+	{
+		this->traverseParallel([&value](T &data){ data = value; }, pool);
+	}
+
+	/**
+	 * @brief Copy constructor: copies the elements into a buffer of its own.
+	 */
+	BasicArray(const BasicArray &other):
+		base_t(other),
+		_container(other._container)
+	{
+		bind();
+		copyInline(other);
+	}
+
+	/**
+	 * @brief Move constructor: takes over the buffer without copying elements.
+	 *
+	 * @details Inline elements are copied. The moved-from array is left empty.
+	 */
+	BasicArray(BasicArray &&other) noexcept:
+		base_t(other),
+		_container(std::move(other._container))
+	{
+		bind();
+		copyInline(other);
+		other.makeEmpty();
+	}
+
+	/**
+	 * @brief Copy assignment: copies the elements, reusing the buffer if it is large enough.
+	 */
+	BasicArray& operator=(const BasicArray &other)
+	{
+		if(this != &other)
+		{
+			_container = other._container;
+			base_t::operator=(other);
+			bind();
+			copyInline(other);
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief Move assignment: takes over the buffer if the allocators allow it, otherwise moves the elements.
+	 *
+	 * @details Inline elements are copied. The moved-from array is left empty.
+	 */
+	BasicArray& operator=(BasicArray &&other) noexcept(NOTHROW_MOVE_ASSIGNMENT)
 	{
-		this->_data = _container.data();
+		if(this != &other)
+		{
+			_container = std::move(other._container);
+			base_t::operator=(other);
+			bind();
+			copyInline(other);
+			other.makeEmpty();
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief Exchange shapes, layouts and buffers without copying elements.
+	 *
+	 * @details Inline elements are copied by move assignments, which may allocate and throw
+	 *          like operator=(BasicArray&&) for allocators that neither propagate nor are always equal.
+	 *          The allocators must be equal unless they propagate on swap.
+	 */
+	void swap(BasicArray &other) noexcept(NOTHROW_MOVE_ASSIGNMENT)
+	{
+		if(isInline() || other.isInline())
+		{
+			BasicArray moved(std::move(other));
+			other = std::move(*this);
+			*this = std::move(moved);
+			return;
+		}
+
+		// buffers keep their addresses, so the data pointers stay valid
+		std::swap(static_cast<base_t&>(*this), static_cast<base_t&>(other));
+		_container.swap(other._container);
+	}
+
+	/**
+	 * @brief Exchange arrays without copying elements.
+	 */
+	friend void swap(BasicArray &a, BasicArray &b) noexcept(noexcept(a.swap(b)))
+	{
+		a.swap(b);
+	}
+
+	/**
+	 * @brief Check if the elements are stored inline in the object.
+	 */
+	bool isInline() const
+	{
+		return INLINE_CAPACITY && this->_size <= INLINE_CAPACITY;
+	}
+
+	/**
+	 * @brief Get the allocator.
+	 */
+	allocator_type get_allocator() const
+	{
+		return _container.get_allocator();
 	}
 
 private:
-	std::vector<T> _container;
+	typedef util::DefaultInitAllocator<ALLOC> container_allocator_t;
+
+	// Move assignment takes over the buffer instead of moving elements into a new one.
+	constexpr static bool NOTHROW_MOVE_ASSIGNMENT =
+			std::allocator_traits<container_allocator_t>::propagate_on_container_move_assignment::value ||
+			std::allocator_traits<container_allocator_t>::is_always_equal::value;
+
+	std::vector<T, container_allocator_t> _container;
 
+	// Number of elements stored in the container.
+	static size_t containerSize(size_t size)
+	{
+		return INLINE_CAPACITY && size <= INLINE_CAPACITY ? 0 : size;
+	}
+
+	// Point the view to the inline elements or the container.
+	void bind() noexcept
+	{
+		this->_data = isInline() ? this->inlineData() : _container.data();
+	}
+
+	// Copy the elements of an inline array of the same size, the container holds the others.
+	void copyInline(const BasicArray &other) noexcept
+	{
+		if(isInline())
+			std::uninitialized_copy_n(other.inlineData(), this->_size, this->_data);
+	}
+
+	// Leave a moved-from array empty and valid.
+	void makeEmpty() noexcept
+	{
+		_container.clear();
+		this->_shape.fill(0);
+		this->_size = 0;
+		bind();
+	}
 };
 
+/**
+ * @brief Basic array in a memory layout given at runtime, e.g. column-major.
+ *
+ * @details Indexing multiplies by the last stride, which row-major arrays skip.
+ */
+template<typename T, size_t NDIM>
+using LayoutArray = BasicArray<T, NDIM, std::allocator<T>, BASIC_ARRAY_INLINE_BYTES, false>;
+
+/**
+ * @brief Basic array with aligned storage, to a cache line by default.
+ *
+ * @details Without inline storage, which is aligned to the element type only.
+ */
+template<typename T, size_t NDIM, size_t ALIGN = 64>
+using AlignedArray = BasicArray<T, NDIM, util::AlignedAllocator<T, ALIGN>, 0>;
+
+/**
+ * @brief Basic array backed with transparent huge pages when large.
+ */
+template<typename T, size_t NDIM>
+using HugePageArray = BasicArray<T, NDIM, util::HugePageAllocator<T>>;
+
+/**
+ * @brief Basic array allocated from a polymorphic memory resource.
+ */
+template<typename T, size_t NDIM>
+using PmrArray = BasicArray<T, NDIM, std::pmr::polymorphic_allocator<T>>;
+
 #endif // BASIC_ARRAY_HPP
@@ -18,17 +18,29 @@
 #ifndef BASIC_ARRAY_TRAVERSAL_HPP
 #define BASIC_ARRAY_TRAVERSAL_HPP
 
+#include "ArrayBase.hpp"
+#include "CacheInfo.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
 #include <array>
+#include <stdexcept>
+#include <type_traits>
 
 /**
  * @brief Class for traversing multidimensional arrays.
  *
  * @details This traversal supports strided arrays.
+ *          Each dimension is iterated by its own template instantiation,
+ *          so the compiler sees the same loop nest as a hand-written one.
  */
 template<typename ITER, size_t NDIM>
 class BasicArrayTraversal
 {
 public:
+
+	static_assert(NDIM, "Number of array dimensions must be larger than zero.");
+
 	BasicArrayTraversal(ITER data,
 						const std::array<size_t, NDIM> &start,
 						const std::array<size_t, NDIM> &end,
@@ -36,43 +48,220 @@ public:
 		_data(data),
 		_start(start),
 		_end(end),
-		_strides(strides),
-		_lastDim(NDIM - 1)
+		_strides(strides)
 	{
 	}
 
 	/**
 	 * @brief Traverse array and apply functor.
+	 *
+	 * @details A functor taking only the element does not need indexes,
+	 *          so it is passed on to traverseValues().
+	 */
+	template<typename FUN>
+	void traverse(FUN &&fun) const
+	{
+		if constexpr (takes_value_only<FUN>)
+			traverseValues(std::forward<FUN>(fun));
+		else
+		{
+			std::array<size_t, NDIM> idx{0};
+
+			iterate<0>(_data, idx, std::forward<FUN>(fun));
+		}
+	}
+
+	/**
+	 * @brief Traverse array elements without indexes and apply functor.
+	 *
+	 * @details Contiguous neighbouring dimensions are collapsed into one,
+	 *          so a dense array is walked by a single flat loop.
+	 */
+	template<typename FUN>
+	void traverseValues(FUN &&fun) const
+	{
+		std::array<size_t, NDIM> len;
+		std::array<size_t, NDIM> strides;
+		collapse(len, strides);
+
+		iterateValues<0>(_data, len, strides, std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Traverse array tile by tile and apply functor.
+	 *
+	 * @details Tiles of tileShape elements, smaller at the upper ends, are visited
+	 *          in the axis order of tileOrder, each one traversed as by traverse().
+	 *          The functor receives the indexes of the whole array.
+	 *
+	 * @throws Runtime error if a tile dimension is zero.
+	 */
+	template<typename FUN>
+	void traverseTiled(FUN &&fun, const std::array<size_t, NDIM> &tileShape, const Layout<NDIM> &tileOrder) const
+	{
+		std::array<size_t, NDIM> numTiles;
+		for(size_t dim = 0; dim < NDIM; dim++)
+		{
+			if(!tileShape[dim])
+				throw std::runtime_error("Tile dimensions must be larger than zero.");
+			numTiles[dim] = (_end[dim] - _start[dim] + tileShape[dim] - 1) / tileShape[dim];
+			if(!numTiles[dim])
+				return;
+		}
+
+		std::array<size_t, NDIM> tile{0};
+		for(bool more = true; more;)
+		{
+			std::array<size_t, NDIM> start;
+			std::array<size_t, NDIM> end;
+			ITER data = _data;
+			for(size_t dim = 0; dim < NDIM; dim++)
+			{
+				start[dim] = _start[dim] + tile[dim] * tileShape[dim];
+				end[dim] = std::min(start[dim] + tileShape[dim], _end[dim]);
+				data += (start[dim] - _start[dim]) * _strides[dim];
+			}
+
+			BasicArrayTraversal(data, start, end, _strides).traverse(fun);
+
+			// next tile, the last axis of the order varies fastest
+			more = false;
+			for(size_t i = NDIM; i-- > 0 && !more;)
+			{
+				const size_t axis = tileOrder.order[i];
+				more = ++tile[axis] < numTiles[axis];
+				if(!more)
+					tile[axis] = 0;
+			}
+		}
+	}
+
+	/**
+	 * @brief Tile shape fitting the data caches found at runtime,
+	 *        for traversals touching two arrays of elements of the given size.
+	 *
+	 * @details A hypercube with an edge of a power of two, the largest of which two tiles fit in the L1 cache,
+	 *          or in the L2 cache if the edge would be shorter than a cache line.
+	 */
+	static std::array<size_t, NDIM> autoTileShape(size_t elementSize)
+	{
+		const util::CacheSizes &caches = util::cacheSizes();
+
+		auto fittingEdge = [elementSize](size_t cacheBytes)
+		{
+			size_t edge = 1;
+			for(;;)
+			{
+				// bytes of two tiles of twice the edge
+				size_t bytes = 2 * elementSize;
+				for(size_t dim = 0; dim < NDIM && bytes <= cacheBytes; dim++)
+					bytes *= 2 * edge;
+				if(bytes > cacheBytes)
+					return edge;
+				edge *= 2;
+			}
+		};
+
+		size_t edge = fittingEdge(caches.l1);
+		if(edge * elementSize < caches.lineSize)
+			edge = fittingEdge(caches.l2);
+
+		std::array<size_t, NDIM> tileShape;
+		tileShape.fill(edge);
+		return tileShape;
+	}
+
+	/**
+	 * @brief Traverse array on a thread pool and apply functor.
+	 *
+	 * @details The outer dimensions are flattened into rows which are split into chunks,
+	 *          each chunk being traversed serially by one of the pool threads.
+	 *          The functor receives the same indexes and elements as with traverse(),
+	 *          but it is called concurrently, so it must be safe to call from several threads.
 	 */
 	template<typename FUN>
-	void traverse(FUN &&fun)
+	void traverseParallel(FUN &&fun, util::ThreadPool &pool) const
 	{
-		// Supporting zero sized arrays.
-		if(_lastDim < 0)
-			return;
+		const size_t minRows = pool.concurrency() * ROWS_PER_THREAD;
 
-		std::array<size_t, NDIM> idx{0};
+		// A single dimension is split into ranges of elements.
+		if constexpr (NDIM == 1)
+		{
+			const size_t len = _end[0] - _start[0];
+			const size_t grain = std::max<size_t>(len / minRows, 1);
+
+			pool.parallelFor(0, len, grain, [this, &fun](size_t first, size_t last)
+			{
+				const std::array<size_t, NDIM> start{_start[0] + first};
+				const std::array<size_t, NDIM> end{_start[0] + last};
+				BasicArrayTraversal(_data + first * _strides[0], start, end, _strides).traverse(fun);
+			});
+		}
+		else
+		{
+			// Flatten enough outer dimensions to keep all threads busy.
+			size_t numOuterDims = 0;
+			size_t numRows = 1;
+			while(numOuterDims < NDIM - 1 && numRows < minRows)
+			{
+				numRows *= _end[numOuterDims] - _start[numOuterDims];
+				numOuterDims++;
+			}
 
-		iterate(_data, 0, idx, std::forward<FUN>(fun));
+			if(!numRows)
+				return;
+
+			const size_t grain = std::max<size_t>(numRows / minRows, 1);
+
+			pool.parallelFor(0, numRows, grain, [this, &fun, numOuterDims](size_t first, size_t last)
+			{
+				std::array<size_t, NDIM> start = _start;
+				std::array<size_t, NDIM> end = _end;
+
+				for(size_t row = first; row < last; row++)
+				{
+					// Unflatten the row into the outer indexes.
+					ITER data = _data;
+					for(size_t dim = numOuterDims, rest = row; dim-- > 0;)
+					{
+						const size_t len = _end[dim] - _start[dim];
+						start[dim] = _start[dim] + rest % len;
+						end[dim] = start[dim] + 1;
+						data += (start[dim] - _start[dim]) * _strides[dim];
+						rest /= len;
+					}
+
+					BasicArrayTraversal(data, start, end, _strides).traverse(fun);
+				}
+			});
+		}
 	}
 
 private:
-	ITER _data;
-	const std::array<size_t, NDIM> &_start;
-	const std::array<size_t, NDIM> &_end;
-	const std::array<size_t, NDIM> &_strides;
-	const long _lastDim; // Takes value -1 for a zero-sized array.
+	// Number of chunks per thread for load balancing.
+	constexpr static size_t ROWS_PER_THREAD = 8;
 
+	const ITER _data;
+	const std::array<size_t, NDIM> _start;
+	const std::array<size_t, NDIM> _end;
+	const std::array<size_t, NDIM> _strides;
+
+	// Whether the functor is called with the element only.
 	template<typename FUN>
-	void iterate(ITER iter, size_t dim, std::array<size_t, NDIM> &idx, FUN &&fun)
+	constexpr static bool takes_value_only =
+			std::is_invocable_v<FUN, decltype(*std::declval<ITER>())> &&
+			!std::is_invocable_v<FUN, const std::array<size_t, NDIM>&, decltype(*std::declval<ITER>())>;
+
+	template<size_t DIM, typename FUN>
+	void iterate(ITER iter, std::array<size_t, NDIM> &idx, FUN &&fun) const
 	{
-		const size_t start = _start[dim];
-		const size_t end = _end[dim];
-		const size_t stride = _strides[dim];
-		size_t &i = idx[dim];
+		const size_t start = _start[DIM];
+		const size_t end = _end[DIM];
+		const size_t stride = _strides[DIM];
+		size_t &i = idx[DIM];
 
 		// last dimension to iterate
-		if(dim == static_cast<size_t>(_lastDim))
+		if constexpr (DIM == NDIM - 1)
 		{
 			for(i = start; i < end; i++, iter += stride)
 				fun(const_cast<const std::array<size_t, NDIM>&>(idx), *iter);
@@ -80,10 +269,72 @@ private:
 		// continue iteration
 		else
 		{
-			const size_t nextDim = dim + 1;
-
 			for(i = start; i < end; i++, iter += stride)
-				iterate(iter, nextDim, idx, std::forward<FUN>(fun));
+				iterate<DIM + 1>(iter, idx, std::forward<FUN>(fun));
+		}
+	}
+
+	// Merge contiguous neighbouring dimensions.
+	// The result is right aligned: leading unused dimensions get unit length.
+	void collapse(std::array<size_t, NDIM> &len, std::array<size_t, NDIM> &strides) const
+	{
+		len.fill(1);
+		strides.fill(0);
+
+		size_t dim = NDIM - 1;
+		len[dim] = _end[dim] - _start[dim];
+		strides[dim] = _strides[dim];
+
+		for(size_t i = NDIM - 1; i-- > 0;)
+		{
+			const size_t dimLen = _end[i] - _start[i];
+
+			if(dimLen == 1)
+				continue;
+
+			if(len[dim] == 1)
+			{
+				len[dim] = dimLen;
+				strides[dim] = _strides[i];
+			}
+			else if(_strides[i] == strides[dim] * len[dim])
+				len[dim] *= dimLen;
+			else
+			{
+				dim--;
+				len[dim] = dimLen;
+				strides[dim] = _strides[i];
+			}
+		}
+	}
+
+	template<size_t DIM, typename FUN>
+	static void iterateValues(ITER iter,
+							  const std::array<size_t, NDIM> &len,
+							  const std::array<size_t, NDIM> &strides, FUN &&fun)
+	{
+		const size_t n = len[DIM];
+		const size_t stride = strides[DIM];
+
+		// last dimension to iterate: a flat loop
+		if constexpr (DIM == NDIM - 1)
+		{
+			if(stride == 1)
+			{
+				for(size_t i = 0; i < n; i++)
+					fun(iter[i]);
+			}
+			else
+			{
+				for(size_t i = 0; i < n; i++, iter += stride)
+					fun(*iter);
+			}
+		}
+		// continue iteration
+		else
+		{
+			for(size_t i = 0; i < n; i++, iter += stride)
+				iterateValues<DIM + 1>(iter, len, strides, std::forward<FUN>(fun));
 		}
 	}
 };
@@ -19,21 +19,113 @@
 #define BASIC_ARRAY_VIEW_HPP
 
 #include "ArrayBase.hpp"
+#include "ArrayCompare.hpp"
 #include "BasicArrayTraversal.hpp"
+#include "BulkCopy.hpp"
+#include "Instrumentation.hpp"
+#include "StridedCopy.hpp"
 #include "TypeTraitUtils.hpp"
 
+template<typename T, size_t NDIM, bool ROW_MAJOR = true>
+class BasicArrayView;
+
+template<typename T, size_t NDIM>
+class StridedArrayView;
+
+template<typename ITER, size_t NDIM>
+class StridedIterator;
+
+template<typename T, size_t NDIM, typename... PERM>
+auto makeTranspose(T *data, const std::array<size_t, NDIM> &shape, const std::array<size_t, NDIM> &strides,
+				   PERM... perm);
+
+template<typename T, size_t NDIM, size_t ONDIM>
+auto makeBroadcast(const T *data, const std::array<size_t, NDIM> &shape, const std::array<size_t, NDIM> &strides,
+				   const std::array<size_t, ONDIM> &outShape);
+
+// Overloads matching the array view types, found by argument dependent lookup.
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::true_type arrayViewMatch(const BasicArrayView<T, NDIM, ROW_MAJOR>*);
+template<typename T, size_t NDIM>
+std::true_type arrayViewMatch(const StridedArrayView<T, NDIM>*);
+std::false_type arrayViewMatch(const void*);
+
 /**
- * @brief Basic (contiguous) Array View class.
+ * @brief Check if a type is (derived from) an array view.
  */
+template<typename T>
+constexpr bool is_array_view_v = decltype(arrayViewMatch(std::declval<const T*>()))::value;
+
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::true_type basicArrayViewMatch(const BasicArrayView<T, NDIM, ROW_MAJOR>*);
+std::false_type basicArrayViewMatch(const void*);
+
+/**
+ * @brief Check if a type is (derived from) a basic array view.
+ */
+template<typename T>
+constexpr bool is_basic_array_view_v = decltype(basicArrayViewMatch(std::declval<const T*>()))::value;
+
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::true_type stridedViewMatch(const BasicArrayView<T, NDIM, ROW_MAJOR>*);
 template<typename T, size_t NDIM>
-class BasicArrayView: public ArrayBase<NDIM>
+std::true_type stridedViewMatch(const StridedArrayView<T, NDIM>*);
+std::false_type stridedViewMatch(const void*);
+
+/**
+ * @brief Check if a type is an array view with a data pointer and strides.
+ */
+template<typename T>
+constexpr bool is_strided_view_v = decltype(stridedViewMatch(std::declval<const T*>()))::value;
+
+template<typename OP, typename E>
+class UnaryExpression;
+
+template<typename OP, typename L, typename R>
+class BinaryExpression;
+
+template<typename OP, typename E>
+std::true_type arrayExpressionMatch(const UnaryExpression<OP, E>*);
+template<typename OP, typename L, typename R>
+std::true_type arrayExpressionMatch(const BinaryExpression<OP, L, R>*);
+std::false_type arrayExpressionMatch(const void*);
+
+/**
+ * @brief Check if a type is a lazy array expression.
+ */
+template<typename T>
+constexpr bool is_array_expression_v = decltype(arrayExpressionMatch(std::declval<const T*>()))::value;
+
+/**
+ * @brief Get an iterator visiting the elements of an array view in row-major order of the indexes.
+ *
+ * @details Basic views iterate in memory order, which differs for layouts other than row-major.
+ */
+template<typename VIEW>
+auto indexBegin(const VIEW &view)
+{
+	if constexpr (is_basic_array_view_v<VIEW>)
+		return view.indexBegin();
+	else
+		return view.begin();
+}
+
+/**
+ * @brief Basic (contiguous) Array View class.
+ *
+ * @details Elements are dense in memory, in row-major order,
+ *          or without ROW_MAJOR in another axis order given by a Layout.
+ *          Indexing the latter multiplies by the last stride, which row-major views know to be 1.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+class BasicArrayView: public ArrayBase<NDIM, ROW_MAJOR>
 {
 public:
 
 	/// This type.
-	typedef BasicArrayView<T, NDIM> this_t;
+	typedef BasicArrayView<T, NDIM, ROW_MAJOR> this_t;
 	/// Base type.
-	typedef ArrayBase<NDIM> base_t;
+	typedef ArrayBase<NDIM, ROW_MAJOR> base_t;
 	/// Type of shape container.
 	typedef typename base_t::shape_t shape_t;
 	/// Data type.
@@ -73,8 +165,37 @@ public:
 			throw std::runtime_error("Shape does not match total size.");
 	}
 
+	/**
+	 * @brief Public constructors with a memory layout, e.g. column-major, for views without ROW_MAJOR.
+	 */
+	BasicArrayView(T *data, shape_t shape, const Layout<NDIM> &layout):
+		base_t(std::move(shape), layout),
+		_data(data)
+	{
+		if(!data)
+			throw std::runtime_error("Array view data pointer cannot be null.");
+	}
+
+	/**
+	 * @brief Get the data pointer.
+	 */
+	T* data()
+	{
+		return _data;
+	}
+
+	/**
+	 * @brief Get the constant data pointer.
+	 */
+	const T* data() const
+	{
+		return _data;
+	}
+
 	/**
 	 * @brief Get begin iterator.
+	 *
+	 * @details Iterators visit the elements in memory order.
 	 */
 	iterator begin()
 	{
@@ -157,7 +278,10 @@ public:
 	public:
 		REF operator[](size_t idx)
 		{
-			return *(_iter + idx);
+			if constexpr (ROW_MAJOR)
+				return *(_iter + idx);
+			else
+				return *(_iter + idx * *_strides);
 		}
 
 	private:
@@ -202,12 +326,69 @@ public:
 		}
 	}
 
+	/**
+	 * @brief Slice the array without copying.
+	 *
+	 * @details Takes a Range or an index per dimension. An index drops the dimension.
+	 *          Returns a strided view.
+	 */
+	template<typename... ARGS>
+	auto slice(ARGS... args)
+	{
+		return makeSlice(_data, this->_shape, this->_strides, args...);
+	}
+
+	/**
+	 * @brief Slice the constant array without copying.
+	 */
+	template<typename... ARGS>
+	auto slice(ARGS... args) const
+	{
+		return makeSlice(const_cast<const T*>(_data), this->_shape, this->_strides, args...);
+	}
+
+	/**
+	 * @brief Transpose the array without copying.
+	 *
+	 * @details Dimension i of the result is dimension perm[i] of the array.
+	 *          Without arguments the order of the dimensions is reversed.
+	 *          Returns a strided view.
+	 */
+	template<typename... PERM>
+	auto transpose(PERM... perm)
+	{
+		return makeTranspose(_data, this->_shape, this->_strides, perm...);
+	}
+
+	/**
+	 * @brief Transpose the constant array without copying.
+	 */
+	template<typename... PERM>
+	auto transpose(PERM... perm) const
+	{
+		return makeTranspose(const_cast<const T*>(_data), this->_shape, this->_strides, perm...);
+	}
+
+	/**
+	 * @brief Broadcast the array to a shape without copying, e.g. to combine it with a larger array.
+	 *
+	 * @details Dimensions are aligned at the end, as in NumPy. Dimensions of length 1
+	 *          and missing leading dimensions are repeated with zero strides.
+	 *          Returns a constant strided view, as repeated elements share memory.
+	 */
+	template<size_t ONDIM>
+	auto broadcast(const std::array<size_t, ONDIM> &shape) const
+	{
+		return makeBroadcast(const_cast<const T*>(_data), this->_shape, this->_strides, shape);
+	}
+
 	/**
 	 * @brief Traverse array indexes while calling a functor.
 	 */
 	template<typename FUN>
 	void traverse(FUN &&fun)
 	{
+		ARRAY_INSTRUMENT(util::Operation::Traverse, this->_size, this->_size * sizeof(T));
 		BasicArrayTraversal<iterator, NDIM>(this->_data, shape_t{0}, this->_shape, this->_strides).
 				traverse(std::forward<FUN>(fun));
 	}
@@ -218,27 +399,138 @@ public:
 	template<typename FUN>
 	void traverse(FUN &&fun) const
 	{
+		ARRAY_INSTRUMENT(util::Operation::Traverse, this->_size, this->_size * sizeof(T));
 		BasicArrayTraversal<const_iterator, NDIM>(this->_data, shape_t{0}, this->_shape, this->_strides).
 				traverse(std::forward<FUN>(fun));
 	}
 
+	/**
+	 * @brief Traverse array indexes tile by tile while calling a functor.
+	 *
+	 * @details Tiles of tileShape elements are visited in the axis order of tileOrder, row-major by default,
+	 *          and the indexes within a tile in row-major order. The functor receives the indexes of the array.
+	 *          Keeps the tiles of both arrays in cache when the functor accesses another array in a different order,
+	 *          e.g. out(i, j) = in(j, i).
+	 *
+	 * @throws Runtime error if a tile dimension is zero.
+	 */
+	template<typename FUN>
+	void traverseTiled(FUN &&fun, const shape_t &tileShape, const Layout<NDIM> &tileOrder = Layout<NDIM>::rowMajor())
+	{
+		ARRAY_INSTRUMENT(util::Operation::Traverse, this->_size, this->_size * sizeof(T));
+		BasicArrayTraversal<iterator, NDIM>(this->_data, shape_t{0}, this->_shape, this->_strides).
+				traverseTiled(std::forward<FUN>(fun), tileShape, tileOrder);
+	}
+
+	/**
+	 * @brief Traverse array indexes tile by tile while calling a functor.
+	 */
+	template<typename FUN>
+	void traverseTiled(FUN &&fun, const shape_t &tileShape,
+					   const Layout<NDIM> &tileOrder = Layout<NDIM>::rowMajor()) const
+	{
+		ARRAY_INSTRUMENT(util::Operation::Traverse, this->_size, this->_size * sizeof(T));
+		BasicArrayTraversal<const_iterator, NDIM>(this->_data, shape_t{0}, this->_shape, this->_strides).
+				traverseTiled(std::forward<FUN>(fun), tileShape, tileOrder);
+	}
+
+	/**
+	 * @brief Traverse array indexes in tiles fitting the data caches while calling a functor.
+	 *
+	 * @details Tiles are sized from the L1 and L2 cache sizes found at runtime,
+	 *          see BasicArrayTraversal::autoTileShape().
+	 */
+	template<typename FUN>
+	void traverseTiled(FUN &&fun)
+	{
+		traverseTiled(std::forward<FUN>(fun), BasicArrayTraversal<iterator, NDIM>::autoTileShape(sizeof(T)));
+	}
+
+	/**
+	 * @brief Traverse array indexes in tiles fitting the data caches while calling a functor.
+	 */
+	template<typename FUN>
+	void traverseTiled(FUN &&fun) const
+	{
+		traverseTiled(std::forward<FUN>(fun), BasicArrayTraversal<iterator, NDIM>::autoTileShape(sizeof(T)));
+	}
+
+	/**
+	 * @brief Traverse array elements while calling a functor without indexes.
+	 */
+	template<typename FUN>
+	void traverseValues(FUN &&fun)
+	{
+		ARRAY_INSTRUMENT(util::Operation::TraverseValues, this->_size, this->_size * sizeof(T));
+		BasicArrayTraversal<iterator, NDIM>(this->_data, shape_t{0}, this->_shape, this->_strides).
+				traverseValues(std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Traverse array elements while calling a functor without indexes.
+	 */
+	template<typename FUN>
+	void traverseValues(FUN &&fun) const
+	{
+		ARRAY_INSTRUMENT(util::Operation::TraverseValues, this->_size, this->_size * sizeof(T));
+		BasicArrayTraversal<const_iterator, NDIM>(this->_data, shape_t{0}, this->_shape, this->_strides).
+				traverseValues(std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Traverse array indexes on a thread pool while calling a functor.
+	 *
+	 * @details The functor is called concurrently and must be safe to call from several threads.
+	 */
+	template<typename FUN>
+	void traverseParallel(FUN &&fun, util::ThreadPool &pool)
+	{
+		ARRAY_INSTRUMENT(util::Operation::TraverseParallel, this->_size, this->_size * sizeof(T));
+		BasicArrayTraversal<iterator, NDIM>(this->_data, shape_t{0}, this->_shape, this->_strides).
+				traverseParallel(std::forward<FUN>(fun), pool);
+	}
+
+	/**
+	 * @brief Traverse array indexes on a thread pool while calling a functor.
+	 *
+	 * @details The functor is called concurrently and must be safe to call from several threads.
+	 */
+	template<typename FUN>
+	void traverseParallel(FUN &&fun, util::ThreadPool &pool) const
+	{
+		ARRAY_INSTRUMENT(util::Operation::TraverseParallel, this->_size, this->_size * sizeof(T));
+		BasicArrayTraversal<const_iterator, NDIM>(this->_data, shape_t{0}, this->_shape, this->_strides).
+				traverseParallel(std::forward<FUN>(fun), pool);
+	}
+
 	/**
 	 * @brief Comparison operator
+	 *
+	 * @details Also compares arrays of the other layout policy.
 	 */
-	bool operator==(const this_t &other) const
+	template<bool OROW_MAJOR>
+	bool operator==(const BasicArrayView<T, NDIM, OROW_MAJOR> &other) const
 	{
-		if(this == &other)
+		if(reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
 			return true;
 
-		if(this->_shape != other._shape)
+		if(this->_shape != other.shape())
 			return false;
 
-		const_iterator thisIter = _data;
-		const_iterator otherIter = other.begin();
-		const const_iterator thisIterEnd = end();
+		ARRAY_INSTRUMENT(util::Operation::Compare, this->_size, 2 * this->_size * sizeof(T));
 
-		while(thisIter != thisIterEnd && *thisIter++ == *otherIter++);
-		return thisIter == thisIterEnd;
+		// different layouts are compared in index order
+		if(this->_strides != other.strides())
+		{
+			const auto thisIterEnd = indexEnd();
+			auto thisIter = indexBegin();
+			auto otherIter = other.indexBegin();
+
+			for(; thisIter != thisIterEnd && *thisIter == *otherIter; ++thisIter, ++otherIter);
+			return thisIter == thisIterEnd;
+		}
+
+		return util::equalRange(_data, other.begin(), this->_size);
 	}
 
 	/**
@@ -247,11 +539,62 @@ public:
 	 * @details
 	 *        Allows to copy only the data.
 	 *        Reserve normal copy operator for copying the view while pointing to the same data.
+	 *        Arrays of the same layout are copied in bulk, by memcpy() for the same element type,
+	 *        arrays of the same shape and different layouts by a cache-oblivious kernel,
+	 *        other arrays in row-major order of the indexes.
+	 *
+	 * @throws Runtime error of array sizes are unequal.
+	 */
+	template<typename OT, size_t ONDIM, bool OROW_MAJOR>
+	BasicArrayView& operator<<(const BasicArrayView<OT, ONDIM, OROW_MAJOR> &other)
+	{
+		if(reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
+			return *this;
+
+		if(this->_size != other.size())
+			throw std::runtime_error("Cannot copy data: array sizes do not match.");
+
+		ARRAY_INSTRUMENT(util::Operation::Copy, this->_size, this->_size * (sizeof(T) + sizeof(OT)));
+
+		bool sameLayout = this->isRowMajor() && other.isRowMajor();
+		if constexpr (ONDIM == NDIM)
+		{
+			if(this->_shape == other.shape())
+			{
+				if(this->_strides != other.strides())
+				{
+					util::stridedCopy(_data, this->_strides, other.begin(), other.strides(), this->_shape);
+					return *this;
+				}
+				sameLayout = true;
+			}
+		}
+
+		if(!sameLayout)
+		{
+			auto otherIter = other.indexBegin();
+			const auto thisIterEnd = indexEnd();
+
+			for(auto thisIter = indexBegin(); thisIter != thisIterEnd; ++thisIter, ++otherIter)
+				*thisIter = *otherIter;
+
+			return *this;
+		}
+
+		util::bulkCopy(_data, other.begin(), this->_size);
+		return *this;
+	}
+
+	/**
+	 * @brief Copy data on a thread pool.
+	 *
+	 * @details Arrays of the same layout are copied in chunks on the pool,
+	 *          others as by operator<<.
 	 *
 	 * @throws Runtime error of array sizes are unequal.
 	 */
-	template<typename OT, size_t ONDIM>
-	BasicArrayView& operator<<(const BasicArrayView<OT, ONDIM> &other)
+	template<typename OT, size_t ONDIM, bool OROW_MAJOR>
+	BasicArrayView& copyParallel(const BasicArrayView<OT, ONDIM, OROW_MAJOR> &other, util::ThreadPool &pool)
 	{
 		if(reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
 			return *this;
@@ -259,13 +602,79 @@ public:
 		if(this->_size != other.size())
 			throw std::runtime_error("Cannot copy data: array sizes do not match.");
 
+		bool sameLayout = this->isRowMajor() && other.isRowMajor();
+		if constexpr (ONDIM == NDIM)
+			sameLayout |= this->_shape == other.shape() && this->_strides == other.strides();
+
+		if(!sameLayout)
+			return *this << other;
+
+		ARRAY_INSTRUMENT(util::Operation::CopyParallel, this->_size, this->_size * (sizeof(T) + sizeof(OT)));
+		util::bulkCopy(_data, other.begin(), this->_size, pool);
+		return *this;
+	}
+
+	/**
+	 * @brief Copy data operator from other view types, e.g. a strided view.
+	 *
+	 * @details Elements are copied in row-major order of the indexes.
+	 *
+	 * @throws Runtime error of array sizes are unequal.
+	 */
+	template<typename OTHER>
+	std::enable_if_t<is_array_view_v<OTHER> && !is_basic_array_view_v<OTHER>, BasicArrayView&>
+	operator<<(const OTHER &other)
+	{
+		if(this->_size != other.size())
+			throw std::runtime_error("Cannot copy data: array sizes do not match.");
+
+		ARRAY_INSTRUMENT(util::Operation::Copy, this->_size,
+						 this->_size * (sizeof(T) + sizeof(typename OTHER::data_t)));
+
+		// e.g. a transposed view
+		if constexpr (std::is_same_v<OTHER, StridedArrayView<typename OTHER::data_t, NDIM>>)
+		{
+			if(this->_shape == other.shape())
+			{
+				util::stridedCopy(_data, this->_strides, other.data(), other.strides(), this->_shape);
+				return *this;
+			}
+		}
+
+		if(!this->isRowMajor())
+		{
+			auto otherIter = other.begin();
+			const auto thisIterEnd = indexEnd();
+
+			for(auto thisIter = indexBegin(); thisIter != thisIterEnd; ++thisIter, ++otherIter)
+				*thisIter = *otherIter;
+
+			return *this;
+		}
+
 		iterator thisIter = _data;
-		typename BasicArrayView<OT, ONDIM>::const_iterator otherIter = other.begin();
+		auto otherIter = other.begin();
 		const const_iterator thisIterEnd = end();
 
-		while(thisIter != thisIterEnd)
-			*thisIter++ = *otherIter++;
+		for(; thisIter != thisIterEnd; ++thisIter, ++otherIter)
+			*thisIter = *otherIter;
+
+		return *this;
+	}
 
+	/**
+	 * @brief Evaluate an expression into the array, e.g. a << b * 2 + c.
+	 *
+	 * @details A single pass without temporaries, see ArrayExpression.hpp.
+	 *
+	 * @throws Runtime error if the shapes differ.
+	 */
+	template<typename EXPR>
+	std::enable_if_t<is_array_expression_v<EXPR>, BasicArrayView&>
+	operator<<(const EXPR &expr)
+	{
+		ARRAY_INSTRUMENT(util::Operation::Copy, this->_size, this->_size * sizeof(T));
+		assignExpression(_data, this->_shape, this->_strides, true, expr);
 		return *this;
 	}
 
@@ -275,8 +684,8 @@ public:
 	 * @details Allows scientific number comparison without copying.
 	 *          Return false if array sizes differ.
 	 */
-	template<typename OT, size_t ONDIM>
-	bool equalValue(const BasicArrayView<OT, ONDIM> &other) const
+	template<typename OT, size_t ONDIM, bool OROW_MAJOR>
+	bool equalValue(const BasicArrayView<OT, ONDIM, OROW_MAJOR> &other) const
 	{
 		if(reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
 			return true;
@@ -284,14 +693,143 @@ public:
 		if(this->_size != other.size())
 			return false;
 
-		iterator thisIter = _data;
-		typename BasicArrayView<OT, ONDIM>::const_iterator otherIter = other.begin();
+		ARRAY_INSTRUMENT(util::Operation::Compare, this->_size, this->_size * (sizeof(T) + sizeof(OT)));
+
+		bool sameLayout = this->isRowMajor() && other.isRowMajor();
+		if constexpr (ONDIM == NDIM)
+			sameLayout = sameLayout || (this->_shape == other.shape() && this->_strides == other.strides());
+
+		if(!sameLayout)
+		{
+			auto otherIter = other.indexBegin();
+			const auto thisIterEnd = indexEnd();
+			auto thisIter = indexBegin();
+
+			for(; thisIter != thisIterEnd && util::eq(*thisIter, *otherIter); ++thisIter, ++otherIter);
+			return thisIter == thisIterEnd;
+		}
+
+		return util::equalRange(_data, other.begin(), this->_size);
+	}
+
+	/**
+	 * @brief Approximate comparison of numbers within tolerances, in one pass.
+	 *
+	 * @details Elements are close if equal, or their difference is at most absTol,
+	 *          or at most relTol times the larger magnitude, or at most maxUlps floating point values apart.
+	 *          Returns the number of mismatches and the indexes of the first one,
+	 *          in memory order if the layouts match, otherwise in row-major index order.
+	 *          Arrays of different sizes have all elements mismatched.
+	 */
+	template<typename OT, size_t ONDIM, bool OROW_MAJOR>
+	util::ApproxComparison<NDIM> approxEqual(const BasicArrayView<OT, ONDIM, OROW_MAJOR> &other,
+											 double absTol, double relTol, uint64_t maxUlps = 0) const
+	{
+		util::ApproxComparison<NDIM> result;
+
+		if(this->_size != other.size())
+		{
+			result.mismatches = this->_size;
+			return result;
+		}
+
+		ARRAY_INSTRUMENT(util::Operation::Compare, this->_size, this->_size * (sizeof(T) + sizeof(OT)));
+
+		bool sameLayout = this->isRowMajor() && other.isRowMajor();
+		if constexpr (ONDIM == NDIM)
+			sameLayout = sameLayout || (this->_shape == other.shape() && this->_strides == other.strides());
+
+		if(!sameLayout)
+		{
+			auto otherIter = other.indexBegin();
+			const auto thisIterEnd = indexEnd();
+
+			for(auto thisIter = indexBegin(); thisIter != thisIterEnd; ++thisIter, ++otherIter)
+			{
+				if(!util::approxEq(*thisIter, *otherIter, absTol, relTol, maxUlps) && !result.mismatches++)
+					result.firstMismatch = thisIter.index();
+			}
+			return result;
+		}
+
+		size_t first = 0;
+		result.mismatches = util::countMismatches(_data, other.begin(), this->_size, absTol, relTol, maxUlps, first);
+
+		// dense data in any layout
+		for(size_t dim = 0; dim < NDIM; dim++)
+			result.firstMismatch[dim] = first / this->_strides[dim] % this->_shape[dim];
+		return result;
+	}
+
+	/**
+	 * @brief Scientifically motivated comparing of values stored in other view types.
+	 *
+	 * @details Elements are compared in row-major order of the indexes.
+	 *          Return false if array sizes differ.
+	 */
+	template<typename OTHER>
+	std::enable_if_t<is_array_view_v<OTHER> && !is_basic_array_view_v<OTHER>, bool>
+	equalValue(const OTHER &other) const
+	{
+		if(this->_size != other.size())
+			return false;
+
+		ARRAY_INSTRUMENT(util::Operation::Compare, this->_size,
+						 this->_size * (sizeof(T) + sizeof(typename OTHER::data_t)));
+
+		if(!this->isRowMajor())
+		{
+			auto otherIter = other.begin();
+			const auto thisIterEnd = indexEnd();
+			auto thisIter = indexBegin();
+
+			for(; thisIter != thisIterEnd && util::eq(*thisIter, *otherIter); ++thisIter, ++otherIter);
+			return thisIter == thisIterEnd;
+		}
+
+		const_iterator thisIter = _data;
+		auto otherIter = other.begin();
 		const const_iterator thisIterEnd = end();
 
-		while(thisIter != thisIterEnd && util::eq(*thisIter++, *otherIter++));
+		for(; thisIter != thisIterEnd && util::eq(*thisIter, *otherIter); ++thisIter, ++otherIter);
 		return thisIter == thisIterEnd;
 	}
 
+	/**
+	 * @brief Get begin iterator visiting the elements in row-major order of the indexes.
+	 *
+	 * @details Same elements as begin() for the row-major layout. A random access iterator exposing its indexes,
+	 *          for standard and parallel algorithms on any layout, see StridedIterator.
+	 */
+	StridedIterator<iterator, NDIM> indexBegin()
+	{
+		return StridedIterator<iterator, NDIM>(_data, this->_shape, this->_strides, 0);
+	}
+
+	/**
+	 * @brief Get const begin iterator visiting the elements in row-major order of the indexes.
+	 */
+	StridedIterator<const_iterator, NDIM> indexBegin() const
+	{
+		return StridedIterator<const_iterator, NDIM>(_data, this->_shape, this->_strides, 0);
+	}
+
+	/**
+	 * @brief Get end iterator visiting the elements in row-major order of the indexes.
+	 */
+	StridedIterator<iterator, NDIM> indexEnd()
+	{
+		return StridedIterator<iterator, NDIM>(_data, this->_shape, this->_strides, this->_size);
+	}
+
+	/**
+	 * @brief Get const end iterator visiting the elements in row-major order of the indexes.
+	 */
+	StridedIterator<const_iterator, NDIM> indexEnd() const
+	{
+		return StridedIterator<const_iterator, NDIM>(_data, this->_shape, this->_strides, this->_size);
+	}
+
 protected:
 	T *_data;
 
@@ -301,6 +839,18 @@ protected:
 		_data(nullptr)
 	{
 	}
+
+	// Protected constructor with a memory layout, for views without ROW_MAJOR.
+	BasicArrayView(shape_t shape, const Layout<NDIM> &layout):
+		base_t(std::move(shape), layout),
+		_data(nullptr)
+	{
+	}
 };
 
+// Strided views returned by slicing.
+#include "StridedArrayView.hpp"
+// Lazy element-wise arithmetic.
+#include "ArrayExpression.hpp"
+
 #endif // BASIC_ARRAY_VIEW_HPP
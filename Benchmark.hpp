@@ -0,0 +1,473 @@
+/**
+ * @file
+ *
+ * @brief Statistical micro-benchmark harness.
+ *
+ * @details Each case is calibrated to a minimum sample duration, warmed up and timed
+ *          in repeated samples. Results report the median, mean, standard deviation
+ *          and percentiles of the time per element, are written as JSON or CSV,
+ *          and are compared against a baseline CSV file to flag regressions.
+ *          Optionally hardware counters are collected over the timed samples
+ *          and reported per element with IPC and bytes per cycle.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include "PerfCounters.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace util
+{
+
+/**
+ * @brief Keep the compiler from eliding the computation of a value, e.g. dead stores to an array.
+ *
+ * @details The address of the value escapes and all memory is considered read and written.
+ */
+template<typename T>
+inline void doNotOptimize(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "g"(&value) : "memory");
+#else
+	static const void *volatile sink;
+	sink = &value;
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * @brief Benchmark settings.
+ */
+struct BenchmarkOptions
+{
+	/// Number of timed samples.
+	size_t samples = 9;
+	/// Number of untimed warm-up samples after calibration.
+	size_t warmupSamples = 1;
+	/// Minimum duration of a sample in seconds, the number of iterations per sample is raised to reach it.
+	double minSampleSeconds = 0.02;
+	/// Collect hardware performance counters, timing only if they are not available.
+	bool counters = false;
+};
+
+/**
+ * @brief Statistics of a benchmark case, times in nanoseconds per element.
+ */
+struct BenchmarkResult
+{
+	std::string name;
+	std::string type;
+	std::vector<size_t> shape;
+	size_t elements = 0;
+	size_t iterations = 0;
+	size_t samples = 0;
+	double median = 0;
+	double mean = 0;
+	double stddev = 0;
+	double min = 0;
+	double p10 = 0;
+	double p90 = 0;
+	/// Bytes read and written per element, 0 if not given.
+	double bytes = 0;
+	/// Hardware event counts per element indexed by PerfEvent, NaN if not counted.
+	perf_counts_t counters = makeNanCounts();
+
+	/**
+	 * @brief Check if any hardware event was counted.
+	 */
+	bool hasCounters() const
+	{
+		return std::any_of(counters.begin(), counters.end(), [](double count) { return !std::isnan(count); });
+	}
+
+	/**
+	 * @brief Count of a hardware event per element, NaN if not counted.
+	 */
+	double counter(PerfEvent event) const
+	{
+		return counters[static_cast<size_t>(event)];
+	}
+
+	/**
+	 * @brief Instructions per cycle, NaN if not counted.
+	 */
+	double ipc() const
+	{
+		return counter(PerfEvent::Instructions) / counter(PerfEvent::Cycles);
+	}
+
+	/**
+	 * @brief Bytes per cycle, NaN if cycles were not counted or bytes not given.
+	 */
+	double bytesPerCycle() const
+	{
+		return bytes > 0 ? bytes / counter(PerfEvent::Cycles) : std::numeric_limits<double>::quiet_NaN();
+	}
+
+	/**
+	 * @brief Shape as text, e.g. 64x64x64.
+	 */
+	std::string shapeText() const
+	{
+		std::string text;
+		for(size_t dimLen : shape)
+			text += (text.empty() ? "" : "x") + std::to_string(dimLen);
+		return text;
+	}
+
+	/**
+	 * @brief Key identifying the case across runs.
+	 */
+	std::string key() const
+	{
+		return name + '/' + type + '/' + shapeText();
+	}
+
+private:
+	static perf_counts_t makeNanCounts()
+	{
+		perf_counts_t counts;
+		counts.fill(std::numeric_limits<double>::quiet_NaN());
+		return counts;
+	}
+};
+
+/**
+ * @brief A case slower than the baseline beyond the threshold.
+ */
+struct BenchmarkRegression
+{
+	std::string key;
+	double baselineMedian;
+	double median;
+
+	double ratio() const
+	{
+		return median / baselineMedian;
+	}
+};
+
+/**
+ * @brief Benchmark runner collecting the results of the cases.
+ */
+class Benchmark
+{
+public:
+
+	explicit Benchmark(const BenchmarkOptions &options = BenchmarkOptions()):
+		_options(options)
+	{
+		if(_options.counters)
+		{
+			_counters = std::make_unique<PerfCounters>();
+			if(!_counters->available())
+				_counters.reset();
+		}
+	}
+
+	/**
+	 * @brief Check if hardware counters are collected, i.e. requested and available.
+	 */
+	bool countersEnabled() const
+	{
+		return _counters != nullptr;
+	}
+
+	/**
+	 * @brief Run a case: the functor performs one iteration over the given number of elements.
+	 *
+	 * @details The functor should pass its results to doNotOptimize().
+	 */
+	template<typename FUN>
+	const BenchmarkResult& run(const std::string &name, const std::string &type,
+							   const std::vector<size_t> &shape, size_t elements, FUN &&fun)
+	{
+		return run(name, type, shape, elements, 0, std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Run a case moving the given number of bytes per element, reported as bytes per cycle.
+	 */
+	template<typename FUN>
+	const BenchmarkResult& run(const std::string &name, const std::string &type,
+							   const std::vector<size_t> &shape, size_t elements, double bytes, FUN &&fun)
+	{
+		typedef std::chrono::steady_clock clock_t;
+
+		auto timeSample = [&fun](size_t iterations)
+		{
+			const auto startTime = clock_t::now();
+			for(size_t i = 0; i < iterations; i++)
+				fun();
+			return std::chrono::duration<double>(clock_t::now() - startTime).count();
+		};
+
+		// calibration doubles as the first warm-up
+		size_t iterations = 1;
+		for(double seconds = timeSample(iterations); seconds < _options.minSampleSeconds;
+				seconds = timeSample(iterations))
+		{
+			iterations = seconds > 0 ?
+					std::max(iterations * 2, static_cast<size_t>(iterations * 1.2 * _options.minSampleSeconds / seconds)) :
+					iterations * 10;
+		}
+
+		for(size_t s = 0; s < _options.warmupSamples; s++)
+			timeSample(iterations);
+
+		std::vector<double> nanos(std::max<size_t>(_options.samples, 1));
+		const double totalElements = static_cast<double>(iterations) * std::max<size_t>(elements, 1);
+
+		// the counters span all timed samples, the cost of the clock is negligible at the sample duration
+		if(_counters)
+			_counters->start();
+		for(double &sample : nanos)
+			sample = timeSample(iterations) * 1e9 / totalElements;
+		if(_counters)
+			_counters->stop();
+
+		BenchmarkResult result;
+		result.name = name;
+		result.type = type;
+		result.shape = shape;
+		result.elements = elements;
+		result.iterations = iterations;
+		result.samples = nanos.size();
+		result.bytes = bytes;
+		if(_counters)
+		{
+			result.counters = _counters->read();
+			for(double &count : result.counters)
+				count /= totalElements * nanos.size();
+		}
+
+		std::sort(nanos.begin(), nanos.end());
+		auto percentile = [&nanos](double p)
+		{
+			return nanos[static_cast<size_t>(std::round(p * (nanos.size() - 1)))];
+		};
+
+		result.median = nanos.size() % 2 ? nanos[nanos.size() / 2] :
+				(nanos[nanos.size() / 2 - 1] + nanos[nanos.size() / 2]) / 2;
+		result.min = nanos.front();
+		result.p10 = percentile(0.1);
+		result.p90 = percentile(0.9);
+
+		for(double sample : nanos)
+			result.mean += sample / nanos.size();
+		for(double sample : nanos)
+			result.stddev += (sample - result.mean) * (sample - result.mean);
+		result.stddev = nanos.size() > 1 ? std::sqrt(result.stddev / (nanos.size() - 1)) : 0;
+
+		_results.push_back(result);
+		return _results.back();
+	}
+
+	/**
+	 * @brief Get the results of all cases run so far.
+	 */
+	const std::vector<BenchmarkResult>& results() const
+	{
+		return _results;
+	}
+
+	/**
+	 * @brief Write the results as a JSON array of objects.
+	 */
+	void writeJson(std::ostream &out) const
+	{
+		out << "[\n";
+		for(size_t i = 0; i < _results.size(); i++)
+		{
+			const BenchmarkResult &r = _results[i];
+
+			out << "  {\"name\": \"" << r.name << "\", \"type\": \"" << r.type << "\", \"shape\": [";
+			for(size_t dim = 0; dim < r.shape.size(); dim++)
+				out << (dim ? ", " : "") << r.shape[dim];
+			out << "], \"elements\": " << r.elements << ", \"iterations\": " << r.iterations <<
+					", \"samples\": " << r.samples << ", \"median_ns\": " << r.median <<
+					", \"mean_ns\": " << r.mean << ", \"stddev_ns\": " << r.stddev << ", \"min_ns\": " << r.min <<
+					", \"p10_ns\": " << r.p10 << ", \"p90_ns\": " << r.p90 << ", \"bytes\": " << r.bytes;
+			for(size_t e = 0; e < PERF_EVENT_COUNT; e++)
+			{
+				out << ", \"" << perfEventName(static_cast<PerfEvent>(e)) << "\": ";
+				writeJsonNumber(out, r.counters[e]);
+			}
+			out << ", \"ipc\": ";
+			writeJsonNumber(out, r.ipc());
+			out << ", \"bytes_per_cycle\": ";
+			writeJsonNumber(out, r.bytesPerCycle());
+			out << '}' << (i + 1 < _results.size() ? "," : "") << '\n';
+		}
+		out << "]\n";
+	}
+
+	/**
+	 * @brief Write the results as CSV with a header line.
+	 */
+	void writeCsv(std::ostream &out) const
+	{
+		out << csvHeader() << '\n';
+		for(const BenchmarkResult &r : _results)
+		{
+			out << r.name << ',' << r.type << ',' << r.shapeText() << ',' << r.elements << ',' <<
+					r.iterations << ',' << r.samples << ',' << r.median << ',' << r.mean << ',' <<
+					r.stddev << ',' << r.min << ',' << r.p10 << ',' << r.p90 << ',' << r.bytes;
+			for(double count : r.counters)
+				out << ',' << count;
+			out << '\n';
+		}
+	}
+
+	/**
+	 * @brief Read results written by writeCsv(), e.g. a stored baseline.
+	 *
+	 * @details Files without the bytes and counter columns are accepted.
+	 *
+	 * @throws Runtime error if the header or a line does not match.
+	 */
+	static std::vector<BenchmarkResult> readCsv(std::istream &in)
+	{
+		std::string line;
+		if(!std::getline(in, line) || (line != csvHeader() && line != CSV_TIMING_HEADER))
+			throw std::runtime_error("Benchmark CSV header does not match.");
+
+		const size_t numFields = line == CSV_TIMING_HEADER ? CSV_TIMING_FIELDS : CSV_TIMING_FIELDS + 1 + PERF_EVENT_COUNT;
+
+		std::vector<BenchmarkResult> results;
+		while(std::getline(in, line))
+		{
+			if(line.empty())
+				continue;
+
+			std::vector<std::string> fields;
+			std::istringstream lineStream(line);
+			for(std::string field; std::getline(lineStream, field, ',');)
+				fields.push_back(field);
+			if(fields.size() != numFields)
+				throw std::runtime_error("Benchmark CSV line does not have " + std::to_string(numFields) +
+										 " fields: " + line);
+
+			BenchmarkResult r;
+			r.name = fields[0];
+			r.type = fields[1];
+			std::istringstream shapeStream(fields[2]);
+			for(std::string dimLen; std::getline(shapeStream, dimLen, 'x');)
+				r.shape.push_back(std::stoul(dimLen));
+			r.elements = std::stoul(fields[3]);
+			r.iterations = std::stoul(fields[4]);
+			r.samples = std::stoul(fields[5]);
+			r.median = std::stod(fields[6]);
+			r.mean = std::stod(fields[7]);
+			r.stddev = std::stod(fields[8]);
+			r.min = std::stod(fields[9]);
+			r.p10 = std::stod(fields[10]);
+			r.p90 = std::stod(fields[11]);
+			if(numFields > CSV_TIMING_FIELDS)
+			{
+				r.bytes = std::stod(fields[12]);
+				for(size_t e = 0; e < PERF_EVENT_COUNT; e++)
+					r.counters[e] = std::stod(fields[13 + e]);
+			}
+			results.push_back(r);
+		}
+		return results;
+	}
+
+	/**
+	 * @brief Find cases whose median is slower than the baseline by more than the threshold fraction.
+	 *
+	 * @details Cases missing from the baseline are skipped.
+	 */
+	std::vector<BenchmarkRegression> compare(const std::vector<BenchmarkResult> &baseline, double threshold) const
+	{
+		std::map<std::string, double> baselineMedians;
+		for(const BenchmarkResult &r : baseline)
+			baselineMedians[r.key()] = r.median;
+
+		std::vector<BenchmarkRegression> regressions;
+		for(const BenchmarkResult &r : _results)
+		{
+			const auto found = baselineMedians.find(r.key());
+			if(found != baselineMedians.end() && r.median > found->second * (1 + threshold))
+				regressions.push_back({r.key(), found->second, r.median});
+		}
+		return regressions;
+	}
+
+private:
+	constexpr static const char *CSV_TIMING_HEADER =
+			"name,type,shape,elements,iterations,samples,median_ns,mean_ns,stddev_ns,min_ns,p10_ns,p90_ns";
+	constexpr static size_t CSV_TIMING_FIELDS = 12;
+
+	static std::string csvHeader()
+	{
+		std::string header = std::string(CSV_TIMING_HEADER) + ",bytes";
+		for(size_t e = 0; e < PERF_EVENT_COUNT; e++)
+			header += std::string(",") + perfEventName(static_cast<PerfEvent>(e));
+		return header;
+	}
+
+	// JSON has no NaN
+	static void writeJsonNumber(std::ostream &out, double value)
+	{
+		if(std::isnan(value))
+			out << "null";
+		else
+			out << value;
+	}
+
+	const BenchmarkOptions _options;
+	std::unique_ptr<PerfCounters> _counters;
+	std::vector<BenchmarkResult> _results;
+};
+
+/**
+ * @brief Print a one line summary of a result, with the counted events per element if any.
+ */
+inline std::ostream& operator<<(std::ostream &out, const BenchmarkResult &r)
+{
+	out << r.key() << ": median " << r.median << " ns, stddev " << r.stddev << " ns, p10 " << r.p10 <<
+			" ns, p90 " << r.p90 << " ns (" << r.samples << " samples of " << r.iterations << " iterations)";
+
+	if(r.hasCounters())
+	{
+		out << ", IPC " << r.ipc();
+		if(r.bytes > 0)
+			out << ", " << r.bytesPerCycle() << " bytes/cycle";
+		out << ", per element:";
+		for(size_t e = 0; e < PERF_EVENT_COUNT; e++)
+			if(!std::isnan(r.counters[e]))
+				out << ' ' << perfEventName(static_cast<PerfEvent>(e)) << ' ' << r.counters[e];
+	}
+	return out;
+}
+
+}
+
+#endif // BENCHMARK_HPP
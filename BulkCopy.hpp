@@ -0,0 +1,150 @@
+/**
+ * @file
+ *
+ * @brief Bulk copy of contiguous elements.
+ *
+ * @details Elements of the same trivially copyable type are copied with memcpy(),
+ *          large blocks with non-temporal stores which bypass the cache.
+ *          Conversions are flat loops the compiler vectorizes.
+ *          Large copies can be split across a thread pool.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef BULK_COPY_HPP
+#define BULK_COPY_HPP
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace util
+{
+
+/// Number of bytes above which copies use non-temporal stores, about the size of a last-level cache.
+constexpr size_t STREAMING_COPY_THRESHOLD = 1 << 23;
+
+/// Number of bytes above which copies are split across a thread pool.
+constexpr size_t PARALLEL_COPY_THRESHOLD = 1 << 22;
+
+/// Minimum number of bytes copied by a pool task.
+constexpr size_t PARALLEL_COPY_GRAIN = 1 << 20;
+
+/**
+ * @brief Copy bytes with non-temporal stores.
+ *
+ * @details The destination is not read into the cache and the copy does not evict
+ *          the working set. Falls back to memcpy() without SSE2.
+ */
+inline void streamingCopy(void *dst, const void *src, size_t bytes)
+{
+#if defined(__SSE2__)
+	char *d = static_cast<char*>(dst);
+	const char *s = static_cast<const char*>(src);
+
+	// align the destination to 16 bytes
+	const size_t head = std::min(bytes, (16 - reinterpret_cast<std::uintptr_t>(d) % 16) % 16);
+	std::memcpy(d, s, head);
+	d += head;
+	s += head;
+	bytes -= head;
+
+	for(; bytes >= 64; d += 64, s += 64, bytes -= 64)
+	{
+		const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+		const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 16));
+		const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 32));
+		const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 48));
+		_mm_stream_si128(reinterpret_cast<__m128i*>(d), v0);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(d + 16), v1);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(d + 32), v2);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(d + 48), v3);
+	}
+	for(; bytes >= 16; d += 16, s += 16, bytes -= 16)
+		_mm_stream_si128(reinterpret_cast<__m128i*>(d), _mm_loadu_si128(reinterpret_cast<const __m128i*>(s)));
+
+	std::memcpy(d, s, bytes);
+
+	// make the streamed data visible to other threads
+	_mm_sfence();
+#else
+	std::memcpy(dst, src, bytes);
+#endif
+}
+
+/**
+ * @brief Copy contiguous elements, converting them to the destination type.
+ *
+ * @details streaming selects non-temporal stores for elements of the same trivially copyable type,
+ *          e.g. when the whole copy does not fit in cache.
+ */
+template<typename DST, typename SRC>
+void bulkCopy(DST *dst, const SRC *src, size_t size, bool streaming)
+{
+	if constexpr (std::is_same_v<DST, SRC> && std::is_trivially_copyable_v<DST>)
+	{
+		if(streaming)
+			streamingCopy(dst, src, size * sizeof(DST));
+		else if(size)
+			std::memcpy(dst, src, size * sizeof(DST));
+	}
+	else
+	{
+		// a plain loop, vectorized for arithmetic conversions
+		for(size_t i = 0; i < size; i++)
+			dst[i] = src[i];
+	}
+}
+
+/**
+ * @brief Copy contiguous elements, large copies on a single thread use non-temporal stores.
+ */
+template<typename DST, typename SRC>
+void bulkCopy(DST *dst, const SRC *src, size_t size)
+{
+	bulkCopy(dst, src, size, size * sizeof(DST) > STREAMING_COPY_THRESHOLD);
+}
+
+/**
+ * @brief Copy contiguous elements on a thread pool.
+ *
+ * @details Copies above PARALLEL_COPY_THRESHOLD bytes are split into chunks of at least
+ *          PARALLEL_COPY_GRAIN bytes, rounded to whole cache lines for byte-sized elements.
+ */
+template<typename DST, typename SRC>
+void bulkCopy(DST *dst, const SRC *src, size_t size, ThreadPool &pool)
+{
+	const size_t bytes = size * std::max(sizeof(DST), sizeof(SRC));
+	if(bytes <= PARALLEL_COPY_THRESHOLD || pool.concurrency() < 2)
+	{
+		bulkCopy(dst, src, size);
+		return;
+	}
+
+	const bool streaming = size * sizeof(DST) > STREAMING_COPY_THRESHOLD;
+	const size_t grain = std::max(PARALLEL_COPY_GRAIN, bytes / (pool.concurrency() * 4)) / 64 * 64 /
+						 std::max(sizeof(DST), sizeof(SRC));
+
+	pool.parallelFor(0, size, grain, [dst, src, streaming](size_t first, size_t last)
+	{
+		bulkCopy(dst + first, src + first, last - first, streaming);
+	});
+}
+
+}
+
+#endif // BULK_COPY_HPP
@@ -0,0 +1,106 @@
+/**
+ * @file
+ *
+ * @brief Data cache sizes of the CPU found at runtime.
+ *
+ * @details Queried once via sysconf() or the Linux sysfs cache directory,
+ *          with typical sizes as fallback.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef CACHE_INFO_HPP
+#define CACHE_INFO_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace util
+{
+
+/**
+ * @brief Sizes of the data caches in bytes.
+ */
+struct CacheSizes
+{
+	size_t lineSize = 64;
+	size_t l1 = 32 << 10;
+	size_t l2 = 1 << 20;
+};
+
+// Size of a data or unified cache level from sysfs, 0 if not found.
+inline size_t sysfsCacheSize(size_t level)
+{
+	for(size_t index = 0; index < 8; index++)
+	{
+		const std::string dir = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + '/';
+
+		size_t cacheLevel = 0;
+		std::string type;
+		if(!(std::ifstream(dir + "level") >> cacheLevel) || !(std::ifstream(dir + "type") >> type) ||
+				cacheLevel != level || type == "Instruction")
+			continue;
+
+		// e.g. 48K or 2048K
+		std::ifstream sizeFile(dir + "size");
+		size_t size = 0;
+		char unit = ' ';
+		if(!(sizeFile >> size))
+			continue;
+		sizeFile >> unit;
+		return size << (unit == 'K' ? 10 : unit == 'M' ? 20 : 0);
+	}
+	return 0;
+}
+
+/**
+ * @brief Get the data cache sizes, found on the first call.
+ */
+inline const CacheSizes& cacheSizes()
+{
+	static const CacheSizes sizes = []
+	{
+		CacheSizes found;
+		size_t l1 = 0;
+		size_t l2 = 0;
+
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_SIZE)
+		const long lineSize = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+		if(lineSize > 0)
+			found.lineSize = lineSize;
+		l1 = std::max(sysconf(_SC_LEVEL1_DCACHE_SIZE), 0L);
+		l2 = std::max(sysconf(_SC_LEVEL2_CACHE_SIZE), 0L);
+#endif
+#ifdef __linux__
+		if(!l1)
+			l1 = sysfsCacheSize(1);
+		if(!l2)
+			l2 = sysfsCacheSize(2);
+#endif
+
+		if(l1)
+			found.l1 = l1;
+		if(l2)
+			found.l2 = l2;
+		return found;
+	}();
+
+	return sizes;
+}
+
+}
+
+#endif // CACHE_INFO_HPP
@@ -0,0 +1,362 @@
+/**
+ * @file
+ *
+ * @brief Copy-on-write contiguous array.
+ *
+ * @details Copies and clones share a reference-counted buffer in O(1),
+ *          the first mutable access of a sharing array copies it.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef COW_ARRAY_HPP
+#define COW_ARRAY_HPP
+
+#include "Allocators.hpp"
+#include "BasicArrayView.hpp"
+#include "ClonableBase.hpp"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Contiguous array with copy-on-write storage.
+ *
+ * @details For read-mostly snapshots passed between stages: copies and clone() share the buffer,
+ *          mutable members, i.e. non-const data(), begin(), end(), operator(), operator[], slice(), transpose(),
+ *          traversals and copies into the array, first give the array a buffer of its own.
+ *          Sharing arrays can be read concurrently without locking.
+ *          Read through a const reference to keep sharing, and use detachedView() in hot loops
+ *          to check for sharing once instead of on every access.
+ *          Mutable access through a BasicArrayView reference or pointer to a sharing array
+ *          does not copy and writes to all sharing arrays.
+ *          Row-major, or without ROW_MAJOR in any memory layout.
+ */
+template<typename T, size_t NDIM, typename ALLOC = std::allocator<T>, bool ROW_MAJOR = true>
+class CowArray final:
+	public BasicArrayView<T, NDIM, ROW_MAJOR>,
+	public ClonableBase<CowArray<T, NDIM, ALLOC, ROW_MAJOR>>
+{
+public:
+
+	/// This type.
+	typedef CowArray<T, NDIM, ALLOC, ROW_MAJOR> this_t;
+	/// Base type.
+	typedef BasicArrayView<T, NDIM, ROW_MAJOR> base_t;
+	/// Type of shape container.
+	typedef typename base_t::shape_t shape_t;
+	/// Allocator type.
+	typedef ALLOC allocator_type;
+
+	/**
+	 * @brief Constructors which initializes with provided value.
+	 */
+	CowArray(shape_t shape, const T &value = T(), const ALLOC &alloc = ALLOC()):
+		base_t(std::move(shape)),
+		_storage(std::make_shared<container_t>(this->size(), value, alloc))
+	{
+		this->_data = _storage->data();
+	}
+
+	/**
+	 * @brief Constructors with a memory layout, e.g. column-major, which initializes with provided value.
+	 *
+	 * @details For arrays without ROW_MAJOR.
+	 */
+	CowArray(shape_t shape, const Layout<NDIM> &layout, const T &value = T(), const ALLOC &alloc = ALLOC()):
+		base_t(std::move(shape), layout),
+		_storage(std::make_shared<container_t>(this->size(), value, alloc))
+	{
+		this->_data = _storage->data();
+	}
+
+	/**
+	 * @brief Constructors which leaves elements of trivial types uninitialized.
+	 */
+	CowArray(shape_t shape, util::uninitialized_t, const ALLOC &alloc = ALLOC()):
+		base_t(std::move(shape)),
+		_storage(std::make_shared<container_t>(this->size(), alloc))
+	{
+		this->_data = _storage->data();
+	}
+
+	/**
+	 * @brief Constructors which copies the elements of an array of the same number of dimensions,
+	 *        e.g. to take a snapshot of a BasicArray.
+	 */
+	template<typename OT, bool OROW_MAJOR>
+	explicit CowArray(const BasicArrayView<OT, NDIM, OROW_MAJOR> &other, const ALLOC &alloc = ALLOC()):
+		CowArray(other.shape(), util::uninitialized, alloc)
+	{
+		base_t::operator<<(other);
+	}
+
+	/**
+	 * @brief Copy constructor: shares the buffer without copying elements.
+	 */
+	CowArray(const CowArray &other) = default;
+
+	/**
+	 * @brief Move constructor: takes over the buffer. The moved-from array is left empty.
+	 */
+	CowArray(CowArray &&other) noexcept:
+		base_t(other),
+		_storage(std::move(other._storage))
+	{
+		other.makeEmpty();
+	}
+
+	/**
+	 * @brief Copy assignment: shares the buffer without copying elements.
+	 */
+	CowArray& operator=(const CowArray &other) = default;
+
+	/**
+	 * @brief Move assignment: takes over the buffer. The moved-from array is left empty.
+	 */
+	CowArray& operator=(CowArray &&other) noexcept
+	{
+		if(this != &other)
+		{
+			base_t::operator=(other);
+			_storage = std::move(other._storage);
+			other.makeEmpty();
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief Check if the buffer is shared with other arrays.
+	 */
+	bool shared() const
+	{
+		return _storage.use_count() > 1;
+	}
+
+	/**
+	 * @brief Give the array a buffer of its own if it is shared.
+	 */
+	void detach()
+	{
+		if(_storage.use_count() > 1)
+		{
+			_storage = std::make_shared<container_t>(*_storage);
+			this->_data = _storage->data();
+		}
+
+		// the count is read relaxed, reads by arrays which shared the buffer happen before writes
+		std::atomic_thread_fence(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief Detach and get a view of the array, valid until the array is copied or destroyed.
+	 *
+	 * @details Accesses through the view do not check for sharing.
+	 */
+	base_t& detachedView()
+	{
+		detach();
+		return *this;
+	}
+
+	/**
+	 * @brief Get the allocator.
+	 */
+	allocator_type get_allocator() const
+	{
+		return _storage->get_allocator();
+	}
+
+	using base_t::data;
+	using base_t::begin;
+	using base_t::end;
+	using base_t::operator();
+	using base_t::operator[];
+	using base_t::slice;
+	using base_t::transpose;
+	using base_t::traverse;
+	using base_t::traverseTiled;
+	using base_t::traverseValues;
+	using base_t::traverseParallel;
+	using base_t::indexBegin;
+	using base_t::indexEnd;
+
+	/**
+	 * @brief Detach and get the data pointer.
+	 */
+	T* data()
+	{
+		detach();
+		return base_t::data();
+	}
+
+	/**
+	 * @brief Detach and get begin iterator.
+	 */
+	typename base_t::iterator begin()
+	{
+		detach();
+		return base_t::begin();
+	}
+
+	/**
+	 * @brief Detach and get end iterator.
+	 */
+	typename base_t::iterator end()
+	{
+		detach();
+		return base_t::end();
+	}
+
+	/**
+	 * @brief Detach and access elements of the array via indexes.
+	 */
+	template<typename... IDX>
+	typename base_t::reference operator()(IDX... idx)
+	{
+		detach();
+		return base_t::operator()(idx...);
+	}
+
+	/**
+	 * @brief Detach and subscript.
+	 */
+	decltype(auto) operator[](size_t idx)
+	{
+		detach();
+		return base_t::operator[](idx);
+	}
+
+	/**
+	 * @brief Detach and slice the array without copying.
+	 */
+	template<typename... ARGS>
+	auto slice(ARGS... args)
+	{
+		detach();
+		return base_t::slice(args...);
+	}
+
+	/**
+	 * @brief Detach and transpose the array without copying.
+	 */
+	template<typename... PERM>
+	auto transpose(PERM... perm)
+	{
+		detach();
+		return base_t::transpose(perm...);
+	}
+
+	/**
+	 * @brief Detach and traverse array indexes while calling a functor.
+	 */
+	template<typename FUN>
+	void traverse(FUN &&fun)
+	{
+		detach();
+		base_t::traverse(std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Detach and traverse array indexes tile by tile while calling a functor.
+	 */
+	template<typename FUN>
+	void traverseTiled(FUN &&fun, const shape_t &tileShape, const Layout<NDIM> &tileOrder = Layout<NDIM>::rowMajor())
+	{
+		detach();
+		base_t::traverseTiled(std::forward<FUN>(fun), tileShape, tileOrder);
+	}
+
+	/**
+	 * @brief Detach and traverse array indexes in tiles fitting the data caches while calling a functor.
+	 */
+	template<typename FUN>
+	void traverseTiled(FUN &&fun)
+	{
+		detach();
+		base_t::traverseTiled(std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Detach and traverse array elements while calling a functor without indexes.
+	 */
+	template<typename FUN>
+	void traverseValues(FUN &&fun)
+	{
+		detach();
+		base_t::traverseValues(std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Detach and traverse array indexes on a thread pool while calling a functor.
+	 */
+	template<typename FUN>
+	void traverseParallel(FUN &&fun, util::ThreadPool &pool)
+	{
+		detach();
+		base_t::traverseParallel(std::forward<FUN>(fun), pool);
+	}
+
+	/**
+	 * @brief Detach and copy data or evaluate an expression into the array, see BasicArrayView::operator<<().
+	 */
+	template<typename OTHER>
+	this_t& operator<<(const OTHER &other)
+	{
+		detach();
+		base_t::operator<<(other);
+		return *this;
+	}
+
+	/**
+	 * @brief Detach and copy data on a thread pool.
+	 */
+	template<typename OT, size_t ONDIM, bool OROW_MAJOR>
+	this_t& copyParallel(const BasicArrayView<OT, ONDIM, OROW_MAJOR> &other, util::ThreadPool &pool)
+	{
+		detach();
+		base_t::copyParallel(other, pool);
+		return *this;
+	}
+
+	/**
+	 * @brief Detach and get begin iterator visiting the elements in row-major order of the indexes.
+	 */
+	StridedIterator<typename base_t::iterator, NDIM> indexBegin()
+	{
+		detach();
+		return base_t::indexBegin();
+	}
+
+	/**
+	 * @brief Detach and get end iterator visiting the elements in row-major order of the indexes.
+	 */
+	StridedIterator<typename base_t::iterator, NDIM> indexEnd()
+	{
+		detach();
+		return base_t::indexEnd();
+	}
+
+private:
+	typedef std::vector<T, util::DefaultInitAllocator<ALLOC>> container_t;
+
+	std::shared_ptr<container_t> _storage;
+
+	// Leave a moved-from array empty, without a buffer to write to.
+	void makeEmpty() noexcept
+	{
+		this->_data = nullptr;
+		this->_shape.fill(0);
+		this->_size = 0;
+	}
+};
+
+#endif // COW_ARRAY_HPP
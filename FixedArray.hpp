@@ -0,0 +1,484 @@
+/**
+ * @file
+ *
+ * @brief Fixed (static extent) arrays.
+ *
+ * @details Arrays whose shape is known at compile time, e.g. small tiles and stencils.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef FIXED_ARRAY_HPP
+#define FIXED_ARRAY_HPP
+
+#include "BasicArrayView.hpp"
+
+#include <utility>
+
+/**
+ * @brief Compile time shape.
+ */
+template<size_t... EXTENTS>
+struct FixedShape
+{
+	static_assert(sizeof...(EXTENTS), "Number of array dimensions must be larger than zero.");
+	static_assert(((EXTENTS > 0) && ...), "Array size cannot be zero, check array dimensions.");
+
+	/// Number of dimensions.
+	constexpr static size_t ndim = sizeof...(EXTENTS);
+
+	/// Type of shape container.
+	typedef std::array<size_t, ndim> shape_t;
+
+	/// Array size.
+	constexpr static size_t size = (EXTENTS * ...);
+
+	/// Array shape.
+	constexpr static shape_t shape{EXTENTS...};
+
+	/// Array strides.
+	constexpr static shape_t strides = []
+	{
+		shape_t strides{0};
+		strides[ndim - 1] = 1;
+		for(size_t i = ndim - 1; i >= 1; i--)
+			strides[i - 1] = strides[i] * shape[i];
+		return strides;
+	}();
+
+	/**
+	 * @brief Computes element offset given array indexes.
+	 */
+	template<typename... IDX>
+	constexpr static size_t computeOffset(IDX... idx)
+	{
+		static_assert(sizeof...(idx) == ndim,
+				"Number of array indexes must be equal to number of dimensions.");
+
+		return computeOffset(std::make_index_sequence<ndim>(), idx...);
+	}
+
+private:
+	template<size_t... DIM, typename... IDX>
+	constexpr static size_t computeOffset(std::index_sequence<DIM...>, IDX... idx)
+	{
+		return ((static_cast<size_t>(idx) * strides[DIM]) + ...);
+	}
+};
+
+template<typename T, size_t... EXTENTS>
+class FixedArrayView;
+
+// Type of a fixed array view with the first dimension dropped.
+template<typename T, size_t FIRST, size_t... REST>
+struct FixedSubView
+{
+	typedef FixedArrayView<T, REST...> type;
+};
+
+/**
+ * @brief Common fixed array functionality (CRTP).
+ *
+ * @details The child provides data().
+ */
+template<typename CHILD, typename T, size_t... EXTENTS>
+class FixedArrayBase
+{
+public:
+
+	/// Compile time shape.
+	typedef FixedShape<EXTENTS...> fixed_shape_t;
+	/// Type of shape container.
+	typedef typename fixed_shape_t::shape_t shape_t;
+	/// Data type.
+	typedef T data_t;
+	/// Iterator type.
+	typedef T* iterator;
+	/// Constant iterator type.
+	typedef const T* const_iterator;
+	/// Reference type.
+	typedef T& reference;
+	/// Constant reference type.
+	typedef const T& const_reference;
+
+	// Number of dimensions, for convenience.
+	constexpr static size_t ndim = fixed_shape_t::ndim;
+
+	/**
+	 * @brief Get array size.
+	 */
+	constexpr static size_t size()
+	{
+		return fixed_shape_t::size;
+	}
+
+	/**
+	 * @brief Get array shape.
+	 */
+	constexpr static const shape_t& shape()
+	{
+		return fixed_shape_t::shape;
+	}
+
+	/**
+	 * @brief Get array strides in number of elements.
+	 */
+	constexpr static const shape_t& strides()
+	{
+		return fixed_shape_t::strides;
+	}
+
+	/**
+	 * @brief Get dimension length.
+	 */
+	template<size_t DIM>
+	constexpr static size_t dim()
+	{
+		static_assert(DIM < ndim,
+				"Dimension index cannot be larger than number of dimensions minus one.");
+
+		return fixed_shape_t::shape[DIM];
+	}
+
+	/**
+	 * @brief Computes element offset given array indexes.
+	 */
+	template<typename... IDX>
+	constexpr static size_t computeOffset(IDX... idx)
+	{
+		return fixed_shape_t::computeOffset(idx...);
+	}
+
+	/**
+	 * @brief Get begin iterator.
+	 */
+	iterator begin()
+	{
+		return child().data();
+	}
+
+	/**
+	 * @brief Get const begin iterator.
+	 */
+	const_iterator begin() const
+	{
+		return child().data();
+	}
+
+	/**
+	 * @brief Get end iterator.
+	 */
+	iterator end()
+	{
+		return child().data() + size();
+	}
+
+	/**
+	 * @brief Get const end iterator.
+	 */
+	const_iterator end() const
+	{
+		return child().data() + size();
+	}
+
+	/**
+	 * @brief Access elements of the array via indexes.
+	 */
+	template<typename... IDX>
+	reference operator()(IDX... idx)
+	{
+		return child().data()[computeOffset(idx...)];
+	}
+
+	/**
+	 * @brief Access elements of the constant array via indexes.
+	 */
+	template<typename... IDX>
+	const_reference operator()(IDX... idx) const
+	{
+		return child().data()[computeOffset(idx...)];
+	}
+
+	/**
+	 * @brief Subscript operator.
+	 *
+	 * @details Returns a view with the first dimension dropped.
+	 */
+	std::conditional_t<ndim == 1, reference, typename FixedSubView<T, EXTENTS...>::type>
+	operator[](size_t idx)
+	{
+		if constexpr (ndim == 1)
+			return child().data()[idx];
+		else
+			return typename FixedSubView<T, EXTENTS...>::type(child().data() + idx * strides()[0]);
+	}
+
+	/**
+	 * @brief Subscript operator.
+	 */
+	std::conditional_t<ndim == 1, const_reference, typename FixedSubView<const T, EXTENTS...>::type>
+	operator[](size_t idx) const
+	{
+		if constexpr (ndim == 1)
+			return child().data()[idx];
+		else
+			return typename FixedSubView<const T, EXTENTS...>::type(child().data() + idx * strides()[0]);
+	}
+
+	/**
+	 * @brief Traverse array indexes while calling a functor.
+	 */
+	template<typename FUN>
+	void traverse(FUN &&fun)
+	{
+		BasicArrayTraversal<iterator, ndim>(begin(), shape_t{0}, shape(), strides()).
+				traverse(std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Traverse array indexes while calling a functor.
+	 */
+	template<typename FUN>
+	void traverse(FUN &&fun) const
+	{
+		BasicArrayTraversal<const_iterator, ndim>(begin(), shape_t{0}, shape(), strides()).
+				traverse(std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Traverse array elements while calling a functor without indexes.
+	 */
+	template<typename FUN>
+	void traverseValues(FUN &&fun)
+	{
+		for(T &data : *this)
+			fun(data);
+	}
+
+	/**
+	 * @brief Traverse array elements while calling a functor without indexes.
+	 */
+	template<typename FUN>
+	void traverseValues(FUN &&fun) const
+	{
+		for(const T &data : *this)
+			fun(data);
+	}
+
+	/**
+	 * @brief Comparison operator
+	 */
+	template<typename OCHILD>
+	bool operator==(const FixedArrayBase<OCHILD, T, EXTENTS...> &other) const
+	{
+		const_iterator thisIter = begin();
+		const_iterator otherIter = other.begin();
+		const const_iterator thisIterEnd = end();
+
+		while(thisIter != thisIterEnd && *thisIter++ == *otherIter++);
+		return thisIter == thisIterEnd;
+	}
+
+	/**
+	 * @brief Copy data operator.
+	 *
+	 * @details Copies from any array view of the same size, in row-major order of the indexes.
+	 *
+	 * @throws Runtime error of array sizes are unequal.
+	 */
+	template<typename OTHER>
+	std::enable_if_t<is_array_view_v<OTHER>, CHILD&>
+	operator<<(const OTHER &other)
+	{
+		if(reinterpret_cast<const void*>(this) != reinterpret_cast<const void*>(&other))
+		{
+			if(size() != other.size())
+				throw std::runtime_error("Cannot copy data: array sizes do not match.");
+
+			auto otherIter = indexBegin(other);
+			for(T &data : *this)
+			{
+				data = *otherIter;
+				++otherIter;
+			}
+		}
+		return child();
+	}
+
+	/**
+	 * @brief Evaluate an expression into the array, e.g. a << b * 2 + c.
+	 *
+	 * @details A single pass without temporaries, see ArrayExpression.hpp.
+	 *
+	 * @throws Runtime error if the shapes differ.
+	 */
+	template<typename EXPR>
+	std::enable_if_t<is_array_expression_v<EXPR>, CHILD&>
+	operator<<(const EXPR &expr)
+	{
+		assignExpression(begin(), shape(), strides(), true, expr);
+		return child();
+	}
+
+	/**
+	 * @brief Scientifically motivated comparing of stored values.
+	 *
+	 * @details Allows scientific number comparison without copying.
+	 *          Return false if array sizes differ.
+	 */
+	template<typename OTHER>
+	std::enable_if_t<is_array_view_v<OTHER>, bool>
+	equalValue(const OTHER &other) const
+	{
+		if(size() != other.size())
+			return false;
+
+		const_iterator thisIter = begin();
+		auto otherIter = indexBegin(other);
+		const const_iterator thisIterEnd = end();
+
+		for(; thisIter != thisIterEnd && util::eq(*thisIter, *otherIter); ++thisIter, ++otherIter);
+		return thisIter == thisIterEnd;
+	}
+
+	/**
+	 * @brief Get a basic array view on the data.
+	 */
+	BasicArrayView<T, ndim> basicView()
+	{
+		return BasicArrayView<T, ndim>(begin(), shape());
+	}
+
+	/**
+	 * @brief Get a basic array view on the constant data.
+	 */
+	BasicArrayView<const T, ndim> basicView() const
+	{
+		return BasicArrayView<const T, ndim>(begin(), shape());
+	}
+
+private:
+	CHILD& child()
+	{
+		return static_cast<CHILD&>(*this);
+	}
+
+	const CHILD& child() const
+	{
+		return static_cast<const CHILD&>(*this);
+	}
+};
+
+// Fixed arrays match the array view types.
+template<typename CHILD, typename T, size_t... EXTENTS>
+std::true_type arrayViewMatch(const FixedArrayBase<CHILD, T, EXTENTS...>*);
+template<typename CHILD, typename T, size_t... EXTENTS>
+std::true_type stridedViewMatch(const FixedArrayBase<CHILD, T, EXTENTS...>*);
+
+/**
+ * @brief Fixed array view class.
+ *
+ * @details Views external data as an array of compile time shape.
+ *          Holds only the data pointer.
+ */
+template<typename T, size_t... EXTENTS>
+class FixedArrayView final: public FixedArrayBase<FixedArrayView<T, EXTENTS...>, T, EXTENTS...>
+{
+public:
+
+	/**
+	 * @brief Public constructors.
+	 */
+	explicit FixedArrayView(T *data):
+		_data(data)
+	{
+		if(!data)
+			throw std::runtime_error("Array view data pointer cannot be null.");
+	}
+
+	/**
+	 * @brief Get pointer to the data.
+	 */
+	T* data() const
+	{
+		return _data;
+	}
+
+private:
+	T *_data;
+};
+
+/**
+ * @brief Fixed array class.
+ *
+ * @details Elements are stored inline, on the stack or within the owning object.
+ *          Value initialized like std::array, so copyable and movable by value.
+ */
+template<typename T, size_t... EXTENTS>
+class FixedArray final: public FixedArrayBase<FixedArray<T, EXTENTS...>, T, EXTENTS...>
+{
+public:
+
+	/// Base type.
+	typedef FixedArrayBase<FixedArray<T, EXTENTS...>, T, EXTENTS...> base_t;
+
+	/**
+	 * @brief Constructors which initializes with default value.
+	 */
+	FixedArray():
+		_container{}
+	{
+	}
+
+	/**
+	 * @brief Constructors which initializes with provided value.
+	 */
+	explicit FixedArray(const T &value)
+	{
+		_container.fill(value);
+	}
+
+	/**
+	 * @brief Get pointer to the data.
+	 */
+	T* data()
+	{
+		return _container.data();
+	}
+
+	/**
+	 * @brief Get pointer to the constant data.
+	 */
+	const T* data() const
+	{
+		return _container.data();
+	}
+
+	/**
+	 * @brief Get a view on the data.
+	 */
+	FixedArrayView<T, EXTENTS...> view()
+	{
+		return FixedArrayView<T, EXTENTS...>(data());
+	}
+
+	/**
+	 * @brief Get a view on the constant data.
+	 */
+	FixedArrayView<const T, EXTENTS...> view() const
+	{
+		return FixedArrayView<const T, EXTENTS...>(data());
+	}
+
+private:
+	std::array<T, base_t::size()> _container;
+};
+
+#endif // FIXED_ARRAY_HPP
@@ -0,0 +1,355 @@
+/**
+ * @file
+ *
+ * @brief Opt-in instrumentation of array operations.
+ *
+ * @details Compiled in with -DARRAY_INSTRUMENTATION, otherwise the hooks expand to nothing.
+ *          Calls, elements, bytes moved and time are counted per operation and per tag
+ *          in counters of the calling thread, which only it writes, and merged on read,
+ *          so a running process can take snapshots without stopping the writers.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef ARRAY_INSTRUMENTATION
+
+/// Count an operation over a number of elements and bytes until the end of the enclosing scope.
+#define ARRAY_INSTRUMENT(operation, elements, bytes) \
+	util::OperationTimer arrayOperationTimer_(operation, elements, bytes)
+
+/// Tag the operations of the calling thread until the end of the enclosing scope.
+#define ARRAY_INSTRUMENT_TAG(tag) \
+	util::InstrumentationTag arrayInstrumentationTag_(tag)
+
+#else
+
+#define ARRAY_INSTRUMENT(operation, elements, bytes) ((void)0)
+#define ARRAY_INSTRUMENT_TAG(tag) ((void)0)
+
+#endif
+
+namespace util
+{
+
+/**
+ * @brief Instrumented array operations.
+ */
+enum class Operation: size_t
+{
+	Traverse,			///< traverse()
+	TraverseValues,		///< traverseValues()
+	TraverseParallel,	///< traverseParallel()
+	Copy,				///< operator<<()
+	CopyParallel,		///< copyParallel()
+	Compare				///< operator==(), equalValue() and approxEqual()
+};
+
+/// Number of instrumented array operations.
+constexpr size_t OPERATION_COUNT = 6;
+
+/// Maximum number of tags counted separately per thread, further tags are counted as one.
+constexpr size_t MAX_INSTRUMENTATION_TAGS = 32;
+
+/**
+ * @brief Name of an operation.
+ */
+inline const char* operationName(Operation operation)
+{
+	constexpr const char *names[OPERATION_COUNT] =
+	{
+		"traverse", "traverseValues", "traverseParallel", "copy", "copyParallel", "compare"
+	};
+	return names[static_cast<size_t>(operation)];
+}
+
+/**
+ * @brief Counts of an operation under a tag, merged over threads.
+ */
+struct OperationStats
+{
+	std::string tag;
+	Operation operation;
+	uint64_t calls = 0;
+	uint64_t elements = 0;
+	uint64_t bytes = 0;
+	/// Number of elements of the largest call.
+	uint64_t maxElements = 0;
+	double seconds = 0;
+};
+
+/**
+ * @brief Per-thread counters of the instrumented operations and their snapshots.
+ */
+class Instrumentation
+{
+public:
+
+	/// Tag of operations outside any tag scope.
+	constexpr static const char *UNTAGGED = "(untagged)";
+
+	/// Tag of operations under tags beyond MAX_INSTRUMENTATION_TAGS.
+	constexpr static const char *OTHER_TAGS = "(other)";
+
+	/**
+	 * @brief Check if the instrumentation is compiled in.
+	 */
+	constexpr static bool enabled()
+	{
+#ifdef ARRAY_INSTRUMENTATION
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	/**
+	 * @brief Merge the counters of all threads, including finished ones.
+	 *
+	 * @details Safe to call while other threads count, each counter is read atomically.
+	 *          Operations never called are left out.
+	 */
+	static std::vector<OperationStats> snapshot()
+	{
+		std::map<std::pair<std::string, size_t>, OperationStats> merged;
+
+		std::lock_guard<std::mutex> lock(registryMutex());
+		for(const auto &thread : registry())
+		{
+			const size_t numTags = thread->numTags.load(std::memory_order_acquire);
+			for(size_t t = 0; t < numTags; t++)
+			{
+				const TagCounters &tagCounters = thread->tags[t];
+				for(size_t op = 0; op < OPERATION_COUNT; op++)
+				{
+					const Counter &counter = tagCounters.operations[op];
+					const uint64_t calls = counter.calls.load(std::memory_order_relaxed);
+					if(!calls)
+						continue;
+
+					OperationStats &stats = merged[{tagCounters.tag, op}];
+					stats.tag = tagCounters.tag;
+					stats.operation = static_cast<Operation>(op);
+					stats.calls += calls;
+					stats.elements += counter.elements.load(std::memory_order_relaxed);
+					stats.bytes += counter.bytes.load(std::memory_order_relaxed);
+					stats.maxElements = std::max<uint64_t>(stats.maxElements,
+							counter.maxElements.load(std::memory_order_relaxed));
+					stats.seconds += counter.nanos.load(std::memory_order_relaxed) * 1e-9;
+				}
+			}
+		}
+
+		std::vector<OperationStats> result;
+		for(auto &entry : merged)
+			result.push_back(std::move(entry.second));
+		return result;
+	}
+
+	/**
+	 * @brief Write a snapshot as CSV with a header line.
+	 */
+	static void write(std::ostream &out)
+	{
+		out << "tag,operation,calls,elements,bytes,max_elements,seconds\n";
+		for(const OperationStats &s : snapshot())
+		{
+			out << s.tag << ',' << operationName(s.operation) << ',' << s.calls << ',' << s.elements << ',' <<
+					s.bytes << ',' << s.maxElements << ',' << s.seconds << '\n';
+		}
+	}
+
+private:
+	friend class OperationTimer;
+	friend class InstrumentationTag;
+
+	// Written only by the owning thread, so updates are plain load and store without locked instructions.
+	struct Counter
+	{
+		std::atomic<uint64_t> calls{0};
+		std::atomic<uint64_t> elements{0};
+		std::atomic<uint64_t> bytes{0};
+		std::atomic<uint64_t> maxElements{0};
+		std::atomic<uint64_t> nanos{0};
+
+		static void add(std::atomic<uint64_t> &value, uint64_t n)
+		{
+			value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+		}
+
+		void add(uint64_t numElements, uint64_t numBytes, uint64_t numNanos)
+		{
+			add(calls, 1);
+			add(elements, numElements);
+			add(bytes, numBytes);
+			add(nanos, numNanos);
+			if(numElements > maxElements.load(std::memory_order_relaxed))
+				maxElements.store(numElements, std::memory_order_relaxed);
+		}
+	};
+
+	struct TagCounters
+	{
+		const char *tag = nullptr;
+		std::array<Counter, OPERATION_COUNT> operations;
+	};
+
+	struct ThreadCounters
+	{
+		std::array<TagCounters, MAX_INSTRUMENTATION_TAGS> tags;
+		// tags below are published to readers
+		std::atomic<size_t> numTags{0};
+		// index of the tag last counted, as consecutive operations mostly share it
+		size_t lastTag = 0;
+
+		Counter& counter(const char *tag, Operation operation)
+		{
+			const size_t numUsed = numTags.load(std::memory_order_relaxed);
+			size_t t = lastTag;
+			if(t >= numUsed || tags[t].tag != tag)
+			{
+				// tags are compared by address, static strings are not merged until read
+				for(t = 0; t < numUsed && tags[t].tag != tag; t++);
+
+				if(t == numUsed)
+				{
+					if(numUsed + 1 < MAX_INSTRUMENTATION_TAGS)
+					{
+						tags[t].tag = tag;
+						numTags.store(numUsed + 1, std::memory_order_release);
+					}
+					else
+					{
+						t = MAX_INSTRUMENTATION_TAGS - 1;
+						if(numUsed < MAX_INSTRUMENTATION_TAGS)
+						{
+							tags[t].tag = OTHER_TAGS;
+							numTags.store(MAX_INSTRUMENTATION_TAGS, std::memory_order_release);
+						}
+					}
+				}
+				lastTag = t;
+			}
+			return tags[t].operations[static_cast<size_t>(operation)];
+		}
+	};
+
+	static std::mutex& registryMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	// Counters outlive their threads, so counts of finished threads are kept.
+	static std::vector<std::shared_ptr<ThreadCounters>>& registry()
+	{
+		static std::vector<std::shared_ptr<ThreadCounters>> threads;
+		return threads;
+	}
+
+	static ThreadCounters& threadCounters()
+	{
+		thread_local const std::shared_ptr<ThreadCounters> counters = []
+		{
+			auto threadCounters = std::make_shared<ThreadCounters>();
+			std::lock_guard<std::mutex> lock(registryMutex());
+			registry().push_back(threadCounters);
+			return threadCounters;
+		}();
+		return *counters;
+	}
+
+	static const char*& currentTag()
+	{
+		thread_local const char *tag = UNTAGGED;
+		return tag;
+	}
+};
+
+/**
+ * @brief Count an operation of the calling thread from construction to destruction.
+ *
+ * @details Used through ARRAY_INSTRUMENT().
+ */
+class OperationTimer
+{
+public:
+
+	OperationTimer(Operation operation, size_t elements, size_t bytes):
+		_counter(Instrumentation::threadCounters().counter(Instrumentation::currentTag(), operation)),
+		_elements(elements),
+		_bytes(bytes),
+		_startTime(std::chrono::steady_clock::now())
+	{
+	}
+
+	~OperationTimer()
+	{
+		const auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - _startTime).count();
+		_counter.add(_elements, _bytes, nanos);
+	}
+
+	OperationTimer(const OperationTimer&) = delete;
+	OperationTimer& operator=(const OperationTimer&) = delete;
+
+private:
+	Instrumentation::Counter &_counter;
+	const size_t _elements;
+	const size_t _bytes;
+	const std::chrono::steady_clock::time_point _startTime;
+};
+
+/**
+ * @brief Tag the operations of the calling thread from construction to destruction.
+ *
+ * @details Used through ARRAY_INSTRUMENT_TAG(). Scopes nest, the innermost tag counts.
+ *          The tag must be a string with static storage duration, e.g. a literal.
+ */
+class InstrumentationTag
+{
+public:
+
+	explicit InstrumentationTag(const char *tag):
+		_previousTag(Instrumentation::currentTag())
+	{
+		Instrumentation::currentTag() = tag;
+	}
+
+	~InstrumentationTag()
+	{
+		Instrumentation::currentTag() = _previousTag;
+	}
+
+	InstrumentationTag(const InstrumentationTag&) = delete;
+	InstrumentationTag& operator=(const InstrumentationTag&) = delete;
+
+private:
+	const char *const _previousTag;
+};
+
+}
+
+#endif // INSTRUMENTATION_HPP
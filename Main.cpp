@@ -18,11 +18,51 @@
 
 #include "TestArray.hpp"
 
+#include <cstring>
+#include <fstream>
+
 using namespace std;
 using namespace util;
 
-int main()
+/**
+ * @brief Run the demos and performance tests.
+ *
+ * @details Options:
+ *          --json PATH        write the benchmark results as JSON
+ *          --csv PATH         write the benchmark results as CSV
+ *          --baseline PATH    compare the benchmark results with a CSV file of an earlier run
+ *          --threshold FRAC   slowdown of the median flagged as a regression, 0.1 by default
+ *          --counters         collect hardware performance counters if available
+ *
+ * @returns 1 if a regression was found, 2 on bad options.
+ */
+int main(int argc, char *argv[])
 {
+	string jsonPath;
+	string csvPath;
+	string baselinePath;
+	double threshold = 0.1;
+	util::BenchmarkOptions benchOptions;
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(i + 1 < argc && !strcmp(argv[i], "--json"))
+			jsonPath = argv[++i];
+		else if(i + 1 < argc && !strcmp(argv[i], "--csv"))
+			csvPath = argv[++i];
+		else if(i + 1 < argc && !strcmp(argv[i], "--baseline"))
+			baselinePath = argv[++i];
+		else if(i + 1 < argc && !strcmp(argv[i], "--threshold"))
+			threshold = stod(argv[++i]);
+		else if(!strcmp(argv[i], "--counters"))
+			benchOptions.counters = true;
+		else
+		{
+			cerr << "Usage: " << argv[0] << " [--json PATH] [--csv PATH] [--baseline PATH] [--threshold FRAC] [--counters]" << endl;
+			return 2;
+		}
+	}
+
 	// Run demo examples of arrays.
 	test::demoBasicArrayView();
 
@@ -32,17 +72,120 @@ int main()
 	test::test_shape_t shape{LEN, LEN, LEN, LEN};
 	float val = 3.14;
 
-	cout << endl << "Performance testing: number of iterations " <<
-			test::NUM_TEST_ITER << '.' << endl;
+	cout << endl << "Performance testing." << endl;
+
+	// Statistics of the benchmarked cases.
+	util::Benchmark bench(benchOptions);
+	if(benchOptions.counters && !bench.countersEnabled())
+		cout << "Hardware performance counters are not available, timing only." << endl;
 
 	// Test access performance via optimized subscript operators.
-	test::testArrayAccessMethod1(shape, val);
+	test::testArrayAccessMethod1(shape, val, bench);
 
 	// Test access performance via optimized variadic function template.
-	test::testArrayAccessMethod2(shape, val);
+	test::testArrayAccessMethod2(shape, val, bench);
 
 	// Test access performance via an index traversing functor.
-	test::testArrayAccessMethod3(shape, val);
+	test::testArrayAccessMethod3(shape, val, bench);
+
+	// Test access performance via an index traversing functor run on a thread pool.
+	util::ThreadPool pool;
+	test::testArrayAccessMethod4(shape, val, pool, bench);
+
+	// Test access performance via a value visitor functor over collapsed dimensions.
+	test::testArrayAccessMethod5(shape, val, bench);
+
+	// Test the cost of initializing arrays on construction.
+	test::testArrayConstruction(shape, val, bench);
+
+	// Compare traversal with a hand-written loop nest over a range of dimensions.
+	test::testTraversalDims(1 << 22, val, bench);
+
+	// Compare tiled and row-major layouts on sweeps along the first dimension.
+	test::testTiledLayout(1 << 22, val, bench);
+
+	// Compare copying between layouts element by element with the cache-oblivious copy.
+	test::testTranspose(1 << 22, val, bench);
+
+	// Compare a fused expression with temporaries and a hand-written traversal.
+	test::testExpression(1 << 22, val, bench);
+
+	// Compare reductions with an accumulating traversal.
+	test::testReduction(1 << 22, val, pool, bench);
+
+	// Compare a broadcast expression with expanding the smaller operand.
+	test::testBroadcast(1 << 22, val, bench);
+
+	// Compare copy bandwidth of an element loop with bulk copies.
+	test::testBulkCopy(1 << 24, val, pool, bench);
+
+	// Compare an element loop with vectorized exact and approximate comparison.
+	test::testCompare(1 << 24, val, bench);
+
+	// Compare deep clones with copy-on-write clones.
+	test::testCopyOnWrite(1 << 24, val, bench);
+
+	// Count allocations of small arrays with and without inline storage.
+	test::testSmallArrays(val, bench);
+
+	// Compare growing a vector of arrays by moves with copies.
+	test::testArrayMoves(1 << 24, val, bench);
+
+	// Compare a traversal of a strided slice with standard algorithms on its iterators.
+	test::testStandardAlgorithms(1 << 22, val, bench);
+
+	// Compare a traversal indexing other arrays with lock-step traversals.
+	test::testZipTraversal(1 << 22, val, bench);
+
+	// Compare a transposing traversal with cache-blocked tiled traversals.
+	test::testTiledTraversal(1 << 24, val, bench);
+
+	// Measure the cost of the instrumentation hooks per call.
+	test::testInstrumentation(val, bench);
+
+	// Benchmark access methods and views over element types, dimensions and shapes.
+	test::benchmarkAccess(bench);
+
+	// Counts of the array operations if instrumentation is compiled in.
+	if(util::Instrumentation::enabled())
+	{
+		cout << endl << "Instrumented operations:" << endl;
+		util::Instrumentation::write(cout);
+	}
+
+	if(!jsonPath.empty())
+	{
+		ofstream json(jsonPath);
+		bench.writeJson(json);
+	}
+
+	if(!csvPath.empty())
+	{
+		ofstream csv(csvPath);
+		bench.writeCsv(csv);
+	}
+
+	if(!baselinePath.empty())
+	{
+		ifstream baselineFile(baselinePath);
+		if(!baselineFile)
+		{
+			cerr << "Cannot open baseline " << baselinePath << endl;
+			return 2;
+		}
+
+		const auto regressions = bench.compare(util::Benchmark::readCsv(baselineFile), threshold);
+
+		cout << endl << "Regressions against " << baselinePath << ": " << regressions.size() << '.' << endl;
+		for(const auto &regression : regressions)
+		{
+			cout << regression.key << ": median " << regression.median << " ns, baseline " <<
+					regression.baselineMedian << " ns, " << regression.ratio() << " times slower." << endl;
+		}
+
+		if(!regressions.empty())
+			return 1;
+	}
 
 	/* Output:
 		A small 3D array:
@@ -60,20 +203,31 @@ int main()
 
 		Good copy.
 		Good clone.
+		Good copy-on-write.
+		Good moves.
+		Good slice.
+		Good value traversal.
+		Good standard algorithms.
+		Good fixed array.
+		Good allocators.
+		Good inline storage.
+		Good mapped array.
+		Good array file.
+		Good tiled array.
+		Good layouts.
+		Good tiled traversal.
+		Good zip traversal.
+		Good expressions.
+		Good reductions.
+		Good broadcasting.
+		Good bulk copy.
+		Good comparison.
+		Good instrumentation.
+		Good parallel traversal.
+		Good parallel initialization.
 
-		Performance testing: number of iterations 100.
-		### Testing array access method 1 (subscript operators).
-		Number of dimensions: 4
-		Array size: 100000000
-		Method 1 write time: 1.02376 ns. (classics highly optimized)
-		### Testing array access method 2 (variadic function template).
-		Number of dimensions: 4
-		Array size: 100000000
-		Method 2 write time: 0.94222 ns. (tends to be the faster one)
-		### Testing array access method 3 (index visitor functor).
-		Number of dimensions: 4
-		Array size: 100000000
-		Method 3 write time: 1.02869 ns (very cool: flexibility and speed)
+		Performance testing.
+		(one section of machine dependent timings per test follows)
 	 */
 
 	return 0;
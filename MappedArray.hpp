@@ -0,0 +1,170 @@
+/**
+ * @file
+ *
+ * @brief Memory-mapped file-backed array.
+ *
+ * @details
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef MAPPED_ARRAY_HPP
+#define MAPPED_ARRAY_HPP
+
+#include "BasicArrayView.hpp"
+#include "Sentry.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Array on a memory-mapped file.
+ *
+ * @details Maps a file region and views it as an array, so the data is paged in on demand
+ *          and the page cache is shared with other processes mapping the same file.
+ *          The array shape is given by the caller, the file holds the raw elements.
+ */
+template<typename T, size_t NDIM>
+class MappedArray final: public BasicArrayView<T, NDIM>
+{
+public:
+
+	static_assert(std::is_trivially_copyable_v<T>, "Mapped array elements must be trivially copyable.");
+
+	/// This type.
+	typedef MappedArray<T, NDIM> this_t;
+	/// Base type.
+	typedef BasicArrayView<T, NDIM> base_t;
+	/// Type of shape container.
+	typedef typename base_t::shape_t shape_t;
+
+	/**
+	 * @brief Mapping modes.
+	 */
+	enum class Mode
+	{
+		ReadOnly,	///< Read only, the element type must be const.
+		Private,	///< Writable private copy-on-write, the file is not changed.
+		Shared		///< Writable and shared, the file is created or extended as needed.
+	};
+
+	/**
+	 * @brief Access pattern advice to the kernel.
+	 */
+	enum class Advice
+	{
+		Normal = MADV_NORMAL,			///< No special treatment.
+		Sequential = MADV_SEQUENTIAL,	///< Full traversal: aggressive read-ahead, early page release.
+		Random = MADV_RANDOM,			///< Random access: no read-ahead.
+		WillNeed = MADV_WILLNEED,		///< Start reading the pages in now.
+		DontNeed = MADV_DONTNEED		///< Pages can be released.
+	};
+
+	/**
+	 * @brief Map an array of the given shape at the byte offset of a file.
+	 *
+	 * @details The offset must be a multiple of the alignment of T.
+	 *
+	 * @throws Runtime error if the offset is misaligned or the file cannot be opened, is too small
+	 *         or cannot be mapped.
+	 */
+	MappedArray(const std::string &path, shape_t shape, Mode mode = Mode::ReadOnly, size_t offset = 0):
+		base_t(std::move(shape)),
+		_mapping(MAP_FAILED),
+		_mappingSize(0)
+	{
+		if(mode == Mode::ReadOnly && !std::is_const_v<T>)
+			throw std::runtime_error("Read only mapping requires a const element type.");
+		if(offset % alignof(T) != 0)
+			throw std::runtime_error("Mapping offset is not a multiple of the element alignment.");
+
+		const int fd = mode == Mode::Shared ? open(path.c_str(), O_RDWR | O_CREAT, 0644) : open(path.c_str(), O_RDONLY);
+		if(fd < 0)
+			throw std::runtime_error(error("Cannot open file " + path));
+		util::Sentry fdSentry([fd]{ close(fd); });
+
+		const size_t bytes = offset + this->size() * sizeof(T);
+
+		struct stat fileStat;
+		if(fstat(fd, &fileStat) != 0)
+			throw std::runtime_error(error("Cannot get size of file " + path));
+
+		if(static_cast<size_t>(fileStat.st_size) < bytes)
+		{
+			if(mode != Mode::Shared)
+				throw std::runtime_error("File " + path + " is too small for the array shape.");
+			if(ftruncate(fd, bytes) != 0)
+				throw std::runtime_error(error("Cannot extend file " + path));
+		}
+
+		// The mapping must start at a page boundary.
+		const size_t pageSize = sysconf(_SC_PAGESIZE);
+		const size_t mappingOffset = offset / pageSize * pageSize;
+		_mappingSize = bytes - mappingOffset;
+
+		const int protection = mode == Mode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+		const int flags = mode == Mode::Shared ? MAP_SHARED : MAP_PRIVATE;
+
+		_mapping = mmap(nullptr, _mappingSize, protection, flags, fd, mappingOffset);
+		if(_mapping == MAP_FAILED)
+			throw std::runtime_error(error("Cannot map file " + path));
+
+		this->_data = reinterpret_cast<T*>(static_cast<char*>(_mapping) + (offset - mappingOffset));
+	}
+
+	/**
+	 * @brief Unmap the file.
+	 */
+	~MappedArray()
+	{
+		munmap(_mapping, _mappingSize);
+	}
+
+	MappedArray(const MappedArray&) = delete;
+	MappedArray& operator=(const MappedArray&) = delete;
+
+	/**
+	 * @brief Advise the kernel on the planned access pattern.
+	 *
+	 * @details The advice is a hint, failures are ignored.
+	 */
+	void advise(Advice advice) const
+	{
+		madvise(_mapping, _mappingSize, static_cast<int>(advice));
+	}
+
+	/**
+	 * @brief Write changes of a shared mapping to the file.
+	 *
+	 * @throws Runtime error if syncing fails.
+	 */
+	void sync() const
+	{
+		if(msync(_mapping, _mappingSize, MS_SYNC) != 0)
+			throw std::runtime_error(error("Cannot sync mapped file"));
+	}
+
+private:
+	void *_mapping;
+	size_t _mappingSize;
+
+	static std::string error(const std::string &message)
+	{
+		return message + ": " + std::strerror(errno);
+	}
+};
+
+#endif // MAPPED_ARRAY_HPP
@@ -0,0 +1,157 @@
+/**
+ * @file
+ *
+ * @brief NUMA memory placement of arrays.
+ *
+ * @details Thin wrappers over the Linux memory policy system calls,
+ *          so no NUMA library is needed at link time.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef NUMA_HPP
+#define NUMA_HPP
+
+#include "BasicArrayView.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace util
+{
+
+/**
+ * @brief NUMA memory policy modes (values of the Linux kernel interface).
+ */
+enum class NumaPolicy: int
+{
+	Default = 0,	///< Allocate on the node of the first touching thread.
+	Preferred = 1,	///< Prefer the first given node, fall back to others.
+	Bind = 2,		///< Allocate only on the given nodes.
+	Interleave = 3	///< Interleave pages over the given nodes.
+};
+
+/**
+ * @brief Check if the system supports NUMA memory policies.
+ */
+inline bool numaAvailable()
+{
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+	int mode = 0;
+	return syscall(SYS_get_mempolicy, &mode, nullptr, 0, nullptr, 0) == 0;
+#else
+	return false;
+#endif
+}
+
+/**
+ * @brief Count pages of a memory range per NUMA node.
+ *
+ * @details Element i of the result is the number of pages on node i.
+ *          Pages not yet touched are not counted.
+ *
+ * @throws Runtime error if the query is not supported.
+ */
+inline std::vector<size_t> numaPageCounts(const void *data, size_t bytes)
+{
+#if defined(__linux__) && defined(SYS_move_pages)
+	const uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+	const uintptr_t first = reinterpret_cast<uintptr_t>(data) / pageSize * pageSize;
+	const uintptr_t last = reinterpret_cast<uintptr_t>(data) + bytes;
+
+	std::vector<void*> pages;
+	for(uintptr_t page = first; page < last; page += pageSize)
+		pages.push_back(reinterpret_cast<void*>(page));
+
+	// Without target nodes the call only reports the current ones.
+	std::vector<int> status(pages.size());
+	if(syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0)
+		throw std::runtime_error(std::string("Cannot query NUMA nodes: ") + std::strerror(errno));
+
+	std::vector<size_t> counts;
+	for(int node : status)
+	{
+		// Negative status is an error code, e.g. for a page not yet touched.
+		if(node < 0)
+			continue;
+		if(static_cast<size_t>(node) >= counts.size())
+			counts.resize(node + 1);
+		counts[node]++;
+	}
+	return counts;
+#else
+	throw std::runtime_error("Cannot query NUMA nodes: not supported.");
+#endif
+}
+
+/**
+ * @brief Set the NUMA policy of a memory range and move pages already touched.
+ *
+ * @details The range is extended to whole pages.
+ *
+ * @throws Runtime error if the policy cannot be set.
+ */
+inline void numaBind(void *data, size_t bytes, const std::vector<size_t> &nodes,
+					 NumaPolicy policy = NumaPolicy::Bind)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+	constexpr unsigned MPOL_MF_MOVE = 1 << 1;
+	constexpr size_t BITS = 8 * sizeof(unsigned long);
+
+	std::vector<unsigned long> mask;
+	for(size_t node : nodes)
+	{
+		if(node / BITS >= mask.size())
+			mask.resize(node / BITS + 1);
+		mask[node / BITS] |= 1ul << (node % BITS);
+	}
+
+	const uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+	const uintptr_t first = reinterpret_cast<uintptr_t>(data) / pageSize * pageSize;
+	const uintptr_t last = reinterpret_cast<uintptr_t>(data) + bytes;
+
+	if(syscall(SYS_mbind, first, last - first, static_cast<int>(policy),
+			   mask.empty() ? nullptr : mask.data(), mask.size() * BITS + 1, MPOL_MF_MOVE) != 0)
+		throw std::runtime_error(std::string("Cannot bind NUMA nodes: ") + std::strerror(errno));
+#else
+	throw std::runtime_error("Cannot bind NUMA nodes: not supported.");
+#endif
+}
+
+/**
+ * @brief Count pages of an array per NUMA node.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::vector<size_t> numaPageCounts(const BasicArrayView<T, NDIM, ROW_MAJOR> &array)
+{
+	return numaPageCounts(array.begin(), array.size() * sizeof(T));
+}
+
+/**
+ * @brief Set the NUMA policy of an array and move pages already touched.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+void numaBind(BasicArrayView<T, NDIM, ROW_MAJOR> &array, const std::vector<size_t> &nodes,
+			  NumaPolicy policy = NumaPolicy::Bind)
+{
+	numaBind(array.begin(), array.size() * sizeof(T), nodes, policy);
+}
+
+}
+
+#endif // NUMA_HPP
@@ -18,7 +18,9 @@
 #ifndef NUMBER_TRAITS_HPP
 #define NUMBER_TRAITS_HPP
 
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace util
 {
@@ -48,6 +50,30 @@ constexpr bool all_unsigned = std::conjunction_v<std::is_unsigned<T>...>;
 template<typename... T>
 constexpr bool same_sign = all_signed<T...> || all_unsigned<T...>;
 
+// Result type of arithmetic on two numbers, mixed signedness integers default to a signed type.
+template<typename T1, typename T2, typename = void>
+struct common_number
+{
+	typedef decltype(std::declval<T1>() + std::declval<T2>()) type;
+};
+
+// The built-in conversions would turn a negative signed integer into a large unsigned one.
+template<typename T1, typename T2>
+struct common_number<T1, T2, std::enable_if_t<all_integer<T1, T2> && !same_sign<T1, T2> &&
+		std::is_unsigned_v<decltype(std::declval<T1>() + std::declval<T2>())>>>
+{
+	typedef long long type;
+};
+
+/**
+ * @brief Type of arithmetic results on mixed number types.
+ *
+ * @details Same as the built-in arithmetic type, except that mixing signed and unsigned
+ *          integers gives a signed type, as eq_int() does for comparisons.
+ */
+template<typename T1, typename T2>
+using common_number_t = typename common_number<T1, T2>::type;
+
 /**
  * @brief Equality comparison for mixed integer numbers.
  *
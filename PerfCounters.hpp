@@ -0,0 +1,204 @@
+/**
+ * @file
+ *
+ * @brief Hardware performance counters of the calling thread.
+ *
+ * @details Thin wrapper over the Linux perf_event_open() system call counting
+ *          cycles, instructions, cache, TLB and branch misses in user space.
+ *          Events the kernel, the CPU or a container does not allow are left out,
+ *          without any the counters are not available.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace util
+{
+
+/**
+ * @brief Counted hardware events.
+ */
+enum class PerfEvent: size_t
+{
+	Cycles,			///< CPU cycles.
+	Instructions,	///< Retired instructions.
+	L1DMisses,		///< Level 1 data cache read misses.
+	LLCMisses,		///< Last-level cache misses.
+	DTLBMisses,		///< Data TLB read misses.
+	BranchMisses	///< Mispredicted branches.
+};
+
+/// Number of counted hardware events.
+constexpr size_t PERF_EVENT_COUNT = 6;
+
+/// Counts of the events, indexed by PerfEvent, NaN for events not counted.
+typedef std::array<double, PERF_EVENT_COUNT> perf_counts_t;
+
+/**
+ * @brief Short name of an event, e.g. for column headers.
+ */
+inline const char* perfEventName(PerfEvent event)
+{
+	constexpr const char *names[PERF_EVENT_COUNT] =
+	{
+		"cycles", "instructions", "l1d_misses", "llc_misses", "dtlb_misses", "branch_misses"
+	};
+	return names[static_cast<size_t>(event)];
+}
+
+/**
+ * @brief Hardware event counters of the calling thread, excluding the kernel.
+ *
+ * @details Events are opened separately, so a missing one does not disable the others.
+ *          Counts are scaled by the fraction of time an event was scheduled
+ *          when the CPU multiplexes more events than it has counters.
+ */
+class PerfCounters
+{
+public:
+
+	PerfCounters()
+	{
+		_fds.fill(-1);
+
+#ifdef __linux__
+		constexpr uint64_t READ_MISS =
+				(PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+		const std::array<std::pair<uint32_t, uint64_t>, PERF_EVENT_COUNT> events =
+		{{
+			{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+			{PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+			{PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | READ_MISS},
+			{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+			{PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | READ_MISS},
+			{PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}
+		}};
+
+		for(size_t e = 0; e < PERF_EVENT_COUNT; e++)
+		{
+			perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = events[e].first;
+			attr.config = events[e].second;
+			attr.disabled = 1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+			// fails e.g. with EACCES or ENOSYS in containers and ENOENT for events the CPU lacks
+			_fds[e] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+		}
+#endif
+	}
+
+	~PerfCounters()
+	{
+#ifdef __linux__
+		for(int fd : _fds)
+			if(fd >= 0)
+				close(fd);
+#endif
+	}
+
+	PerfCounters(const PerfCounters&) = delete;
+	PerfCounters& operator=(const PerfCounters&) = delete;
+
+	/**
+	 * @brief Check if any event is counted.
+	 */
+	bool available() const
+	{
+		for(int fd : _fds)
+			if(fd >= 0)
+				return true;
+		return false;
+	}
+
+	/**
+	 * @brief Check if an event is counted.
+	 */
+	bool available(PerfEvent event) const
+	{
+		return _fds[static_cast<size_t>(event)] >= 0;
+	}
+
+	/**
+	 * @brief Reset the counts and start counting.
+	 */
+	void start()
+	{
+#ifdef __linux__
+		for(int fd : _fds)
+			if(fd >= 0)
+				ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+		for(int fd : _fds)
+			if(fd >= 0)
+				ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+	}
+
+	/**
+	 * @brief Stop counting.
+	 */
+	void stop()
+	{
+#ifdef __linux__
+		for(int fd : _fds)
+			if(fd >= 0)
+				ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+	}
+
+	/**
+	 * @brief Get the counts between start() and stop().
+	 *
+	 * @returns Counts indexed by PerfEvent, NaN for events not counted or never scheduled.
+	 */
+	perf_counts_t read() const
+	{
+		perf_counts_t counts;
+		counts.fill(std::numeric_limits<double>::quiet_NaN());
+
+#ifdef __linux__
+		for(size_t e = 0; e < PERF_EVENT_COUNT; e++)
+		{
+			// value, time enabled, time running
+			uint64_t values[3];
+			if(_fds[e] >= 0 && ::read(_fds[e], values, sizeof(values)) == static_cast<ssize_t>(sizeof(values)) && values[2])
+				counts[e] = static_cast<double>(values[0]) * values[1] / values[2];
+		}
+#endif
+		return counts;
+	}
+
+private:
+	std::array<int, PERF_EVENT_COUNT> _fds;
+};
+
+}
+
+#endif // PERF_COUNTERS_HPP
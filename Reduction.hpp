@@ -0,0 +1,654 @@
+/**
+ * @file
+ *
+ * @brief Reductions of arrays: sum, mean, L2 norm, min, max and their positions.
+ *
+ * @details Full reductions and reductions along one axis of basic arrays.
+ *          Kernels keep several independent accumulators, so the dependency chain
+ *          is broken and the compiler can vectorize them.
+ *          Reductions optionally run on a thread pool; partial results are combined
+ *          in a fixed order, so the result does not depend on the scheduling.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef REDUCTION_HPP
+#define REDUCTION_HPP
+
+#include "BasicArray.hpp"
+#include "ThreadPool.hpp"
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace util
+{
+
+/// Number of independent accumulators of reduction kernels.
+constexpr size_t REDUCE_LANES = 8;
+
+/// Minimum number of elements reduced by a pool task.
+constexpr size_t REDUCE_GRAIN = 1 << 16;
+
+/// Number of elements along the inner dimensions reduced at once along an axis.
+constexpr size_t REDUCE_AXIS_BLOCK = 256;
+
+/**
+ * @brief Summation modes.
+ */
+enum class Summation
+{
+	Fast,	///< Plain sums in several accumulators.
+	Kahan	///< Compensated sums of floating point numbers, no drift on large arrays.
+};
+
+/// Type of sums of elements: integers are summed in 64 bits.
+template<typename T>
+using sum_t = std::conditional_t<std::is_integral_v<T>,
+		std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>, T>;
+
+/// Floating point type of means and norms.
+template<typename T>
+using real_t = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+/**
+ * @brief Sum reduction.
+ *
+ * @details Reductions give the accumulator identity, accumulate elements,
+ *          combine partial accumulators and finish the result.
+ *          Summing reductions add up term(element) and support Kahan summation.
+ */
+template<typename T>
+struct SumReduction
+{
+	typedef sum_t<T> acc_t;
+	typedef acc_t result_t;
+	constexpr static bool summing = true;
+
+	static acc_t identity() { return 0; }
+	static acc_t term(const T &value) { return value; }
+	static acc_t accumulate(acc_t acc, const T &value) { return acc + term(value); }
+	static acc_t combine(acc_t acc1, acc_t acc2) { return acc1 + acc2; }
+	static result_t finish(acc_t acc, size_t) { return acc; }
+};
+
+/**
+ * @brief Mean reduction.
+ */
+template<typename T>
+struct MeanReduction: SumReduction<T>
+{
+	typedef real_t<T> result_t;
+
+	static result_t finish(sum_t<T> acc, size_t count) { return static_cast<result_t>(acc) / count; }
+};
+
+/**
+ * @brief L2 norm reduction.
+ */
+template<typename T>
+struct Norm2Reduction
+{
+	typedef real_t<T> acc_t;
+	typedef acc_t result_t;
+	constexpr static bool summing = true;
+
+	static acc_t identity() { return 0; }
+	static acc_t term(const T &value) { return static_cast<acc_t>(value) * value; }
+	static acc_t accumulate(acc_t acc, const T &value) { return acc + term(value); }
+	static acc_t combine(acc_t acc1, acc_t acc2) { return acc1 + acc2; }
+	static result_t finish(acc_t acc, size_t) { return std::sqrt(acc); }
+};
+
+/**
+ * @brief Minimum reduction.
+ */
+template<typename T>
+struct MinReduction
+{
+	typedef T acc_t;
+	typedef T result_t;
+	constexpr static bool summing = false;
+
+	static acc_t identity() { return std::numeric_limits<T>::max(); }
+	static acc_t accumulate(acc_t acc, const T &value) { return value < acc ? value : acc; }
+	static acc_t combine(acc_t acc1, acc_t acc2) { return accumulate(acc1, acc2); }
+	static result_t finish(acc_t acc, size_t) { return acc; }
+};
+
+/**
+ * @brief Maximum reduction.
+ */
+template<typename T>
+struct MaxReduction
+{
+	typedef T acc_t;
+	typedef T result_t;
+	constexpr static bool summing = false;
+
+	static acc_t identity() { return std::numeric_limits<T>::lowest(); }
+	static acc_t accumulate(acc_t acc, const T &value) { return acc < value ? value : acc; }
+	static acc_t combine(acc_t acc1, acc_t acc2) { return accumulate(acc1, acc2); }
+	static result_t finish(acc_t acc, size_t) { return acc; }
+};
+
+// Whether a reduction sums up floating point numbers with compensation.
+template<typename RED>
+constexpr bool kahan_capable = RED::summing && std::is_floating_point_v<typename RED::acc_t>;
+
+// Add a term to a compensated sum.
+template<typename ACC>
+inline void kahanAdd(ACC &sum, ACC &compensation, ACC term)
+{
+	const ACC y = term - compensation;
+	const ACC t = sum + y;
+	compensation = (t - sum) - y;
+	sum = t;
+}
+
+/**
+ * @brief Reduce a contiguous range of elements.
+ *
+ * @details Element i goes to accumulator i % REDUCE_LANES, the accumulators are combined at the end.
+ */
+template<typename RED, typename T>
+typename RED::acc_t reduceRange(const T *data, size_t size, Summation summation)
+{
+	typedef typename RED::acc_t acc_t;
+
+	std::array<acc_t, REDUCE_LANES> acc;
+	acc.fill(RED::identity());
+	size_t i = 0;
+
+	if constexpr (kahan_capable<RED>)
+	{
+		if(summation == Summation::Kahan)
+		{
+			std::array<acc_t, REDUCE_LANES> compensation{};
+
+			for(; i + REDUCE_LANES <= size; i += REDUCE_LANES)
+				for(size_t lane = 0; lane < REDUCE_LANES; lane++)
+					kahanAdd(acc[lane], compensation[lane], RED::term(data[i + lane]));
+			for(; i < size; i++)
+				kahanAdd(acc[0], compensation[0], RED::term(data[i]));
+
+			acc_t sum = 0;
+			acc_t sumCompensation = 0;
+			for(size_t lane = 0; lane < REDUCE_LANES; lane++)
+				kahanAdd(sum, sumCompensation, acc[lane] - compensation[lane]);
+			return sum;
+		}
+	}
+
+	for(; i + REDUCE_LANES <= size; i += REDUCE_LANES)
+		for(size_t lane = 0; lane < REDUCE_LANES; lane++)
+			acc[lane] = RED::accumulate(acc[lane], data[i + lane]);
+	for(; i < size; i++)
+		acc[0] = RED::accumulate(acc[0], data[i]);
+
+	acc_t result = acc[0];
+	for(size_t lane = 1; lane < REDUCE_LANES; lane++)
+		result = RED::combine(result, acc[lane]);
+	return result;
+}
+
+// Split [0, size) into chunks on the pool and combine fun(first, last) of the chunks in order.
+template<typename ACC, typename FUN, typename COMBINE>
+ACC reduceChunks(size_t size, ThreadPool *pool, FUN &&fun, COMBINE &&combine)
+{
+	if(!pool || size < 2 * REDUCE_GRAIN)
+		return fun(0, size);
+
+	const size_t grain = std::max(REDUCE_GRAIN, size / (pool->concurrency() * 4));
+	std::vector<ACC> partial((size + grain - 1) / grain);
+
+	pool->parallelFor(0, size, grain, [&partial, &fun, grain](size_t first, size_t last)
+	{
+		partial[first / grain] = fun(first, last);
+	});
+
+	ACC result = partial[0];
+	for(size_t i = 1; i < partial.size(); i++)
+		result = combine(result, partial[i]);
+	return result;
+}
+
+// Reduce all elements of dense data, in any layout.
+template<typename RED, typename T>
+typename RED::result_t reduceAll(const T *data, size_t size, Summation summation, ThreadPool *pool)
+{
+	typedef typename RED::acc_t acc_t;
+
+	const acc_t acc = reduceChunks<acc_t>(size, pool,
+		[data, summation](size_t first, size_t last)
+		{
+			return reduceRange<RED>(data + first, last - first, summation);
+		},
+		[summation](acc_t acc1, acc_t acc2)
+		{
+			return RED::combine(acc1, acc2);
+		});
+
+	return RED::finish(acc, size);
+}
+
+// Reduce row-major dense data of shape {outer, len, inner} along the middle dimension
+// into result data of shape {outer, inner}.
+template<typename RED, typename T>
+void reduceAxis(const T *data, size_t outer, size_t len, size_t inner,
+				typename RED::result_t *result, Summation summation, ThreadPool *pool)
+{
+	typedef typename RED::acc_t acc_t;
+
+	// the last dimension: contiguous ranges
+	if(inner == 1)
+	{
+		auto reduceRows = [=](size_t first, size_t last)
+		{
+			for(size_t row = first; row < last; row++)
+				result[row] = RED::finish(reduceRange<RED>(data + row * len, len, summation), len);
+		};
+
+		if(pool)
+			pool->parallelFor(0, outer, std::max<size_t>(REDUCE_GRAIN / len, 1), reduceRows);
+		else
+			reduceRows(0, outer);
+		return;
+	}
+
+	// other dimensions: accumulate whole rows of a block of the inner dimensions
+	const size_t numBlocks = (inner + REDUCE_AXIS_BLOCK - 1) / REDUCE_AXIS_BLOCK;
+	const bool kahan = kahan_capable<RED> && summation == Summation::Kahan;
+
+	auto reduceBlocks = [=](size_t first, size_t last)
+	{
+		std::array<acc_t, REDUCE_AXIS_BLOCK> acc;
+		std::array<acc_t, REDUCE_AXIS_BLOCK> compensation;
+
+		for(size_t task = first; task < last; task++)
+		{
+			const size_t o = task / numBlocks;
+			const size_t begin = task % numBlocks * REDUCE_AXIS_BLOCK;
+			const size_t n = std::min(REDUCE_AXIS_BLOCK, inner - begin);
+			const T *row = data + o * len * inner + begin;
+
+			acc.fill(RED::identity());
+			compensation.fill(0);
+
+			for(size_t k = 0; k < len; k++, row += inner)
+			{
+				if constexpr (kahan_capable<RED>)
+				{
+					if(kahan)
+					{
+						for(size_t j = 0; j < n; j++)
+							kahanAdd(acc[j], compensation[j], RED::term(row[j]));
+						continue;
+					}
+				}
+				for(size_t j = 0; j < n; j++)
+					acc[j] = RED::accumulate(acc[j], row[j]);
+			}
+
+			for(size_t j = 0; j < n; j++)
+				result[o * inner + begin + j] = RED::finish(acc[j], len);
+		}
+	};
+
+	if(pool)
+		pool->parallelFor(0, outer * numBlocks, std::max<size_t>(REDUCE_GRAIN / (len * REDUCE_AXIS_BLOCK), 1),
+						  reduceBlocks);
+	else
+		reduceBlocks(0, outer * numBlocks);
+}
+
+// Reduce an array along an axis.
+template<typename RED, size_t AXIS, typename T, size_t NDIM, bool ROW_MAJOR>
+BasicArray<typename RED::result_t, NDIM - 1>
+reduceAlong(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, Summation summation, ThreadPool *pool)
+{
+	static_assert(NDIM > 1, "Reduce one-dimensional arrays fully.");
+	static_assert(AXIS < NDIM, "Axis must be smaller than number of dimensions.");
+
+	typedef std::remove_const_t<T> value_t;
+
+	// other layouts are copied to row-major first
+	if(!array.isRowMajor())
+	{
+		BasicArray<value_t, NDIM> rowMajor(array.shape(), uninitialized);
+		rowMajor << array;
+		return reduceAlong<RED, AXIS>(static_cast<const BasicArrayView<value_t, NDIM>&>(rowMajor), summation, pool);
+	}
+
+	std::array<size_t, NDIM - 1> shape;
+	size_t outer = 1;
+	size_t inner = 1;
+	for(size_t dim = 0, outDim = 0; dim < NDIM; dim++)
+	{
+		if(dim == AXIS)
+			continue;
+		shape[outDim++] = array.shape()[dim];
+		(dim < AXIS ? outer : inner) *= array.shape()[dim];
+	}
+
+	BasicArray<typename RED::result_t, NDIM - 1> result(shape, uninitialized);
+	reduceAxis<RED>(array.begin(), outer, array.shape()[AXIS], inner, result.begin(), summation, pool);
+	return result;
+}
+
+// Position of the best element of a contiguous range, the first one of equal elements.
+template<bool MAX, typename T>
+std::pair<T, size_t> bestInRange(const T *data, size_t first, size_t last)
+{
+	auto better = [](const T &value, const T &best)
+	{
+		return MAX ? best < value : value < best;
+	};
+
+	std::array<T, REDUCE_LANES> best;
+	std::array<size_t, REDUCE_LANES> pos;
+	best.fill(data[first]);
+	pos.fill(first);
+
+	size_t i = first;
+	for(; i + REDUCE_LANES <= last; i += REDUCE_LANES)
+	{
+		for(size_t lane = 0; lane < REDUCE_LANES; lane++)
+		{
+			if(better(data[i + lane], best[lane]))
+			{
+				best[lane] = data[i + lane];
+				pos[lane] = i + lane;
+			}
+		}
+	}
+	for(; i < last; i++)
+	{
+		if(better(data[i], best[0]))
+		{
+			best[0] = data[i];
+			pos[0] = i;
+		}
+	}
+
+	std::pair<T, size_t> result(best[0], pos[0]);
+	for(size_t lane = 1; lane < REDUCE_LANES; lane++)
+	{
+		if(better(best[lane], result.first) || (!better(result.first, best[lane]) && pos[lane] < result.second))
+			result = {best[lane], pos[lane]};
+	}
+	return result;
+}
+
+// Indexes of the best element, the first one in memory of equal elements.
+template<bool MAX, typename T, size_t NDIM, bool ROW_MAJOR>
+std::array<size_t, NDIM> argBest(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool *pool)
+{
+	if(array.size() == 0)
+		throw std::runtime_error("Cannot find the minimum or maximum of an empty array.");
+
+	typedef std::remove_const_t<T> value_t;
+	const value_t *data = array.begin();
+
+	const auto best = reduceChunks<std::pair<value_t, size_t>>(array.size(), pool,
+		[data](size_t first, size_t last)
+		{
+			return bestInRange<MAX>(data, first, last);
+		},
+		[](const std::pair<value_t, size_t> &best1, const std::pair<value_t, size_t> &best2)
+		{
+			return (MAX ? best1.first < best2.first : best2.first < best1.first) ? best2 : best1;
+		});
+
+	// dense data in any layout
+	std::array<size_t, NDIM> idx;
+	for(size_t dim = 0; dim < NDIM; dim++)
+		idx[dim] = best.second / array.strides()[dim] % array.shape()[dim];
+	return idx;
+}
+
+/**
+ * @brief Sum of the elements.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+sum_t<T> sum(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, Summation summation = Summation::Fast)
+{
+	return reduceAll<SumReduction<std::remove_const_t<T>>>(array.begin(), array.size(), summation, nullptr);
+}
+
+/**
+ * @brief Sum of the elements on a thread pool.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+sum_t<T> sum(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool, Summation summation = Summation::Fast)
+{
+	return reduceAll<SumReduction<std::remove_const_t<T>>>(array.begin(), array.size(), summation, &pool);
+}
+
+/**
+ * @brief Mean of the elements.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+real_t<T> mean(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, Summation summation = Summation::Fast)
+{
+	return reduceAll<MeanReduction<std::remove_const_t<T>>>(array.begin(), array.size(), summation, nullptr);
+}
+
+/**
+ * @brief Mean of the elements on a thread pool.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+real_t<T> mean(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool,
+			   Summation summation = Summation::Fast)
+{
+	return reduceAll<MeanReduction<std::remove_const_t<T>>>(array.begin(), array.size(), summation, &pool);
+}
+
+/**
+ * @brief L2 norm of the elements.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+real_t<T> norm2(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, Summation summation = Summation::Fast)
+{
+	return reduceAll<Norm2Reduction<std::remove_const_t<T>>>(array.begin(), array.size(), summation, nullptr);
+}
+
+/**
+ * @brief L2 norm of the elements on a thread pool.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+real_t<T> norm2(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool,
+				Summation summation = Summation::Fast)
+{
+	return reduceAll<Norm2Reduction<std::remove_const_t<T>>>(array.begin(), array.size(), summation, &pool);
+}
+
+/**
+ * @brief Minimum element.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::remove_const_t<T> min(const BasicArrayView<T, NDIM, ROW_MAJOR> &array)
+{
+	return reduceAll<MinReduction<std::remove_const_t<T>>>(array.begin(), array.size(), Summation::Fast, nullptr);
+}
+
+/**
+ * @brief Minimum element on a thread pool.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::remove_const_t<T> min(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool)
+{
+	return reduceAll<MinReduction<std::remove_const_t<T>>>(array.begin(), array.size(), Summation::Fast, &pool);
+}
+
+/**
+ * @brief Maximum element.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::remove_const_t<T> max(const BasicArrayView<T, NDIM, ROW_MAJOR> &array)
+{
+	return reduceAll<MaxReduction<std::remove_const_t<T>>>(array.begin(), array.size(), Summation::Fast, nullptr);
+}
+
+/**
+ * @brief Maximum element on a thread pool.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::remove_const_t<T> max(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool)
+{
+	return reduceAll<MaxReduction<std::remove_const_t<T>>>(array.begin(), array.size(), Summation::Fast, &pool);
+}
+
+/**
+ * @brief Indexes of the minimum element, the first one in memory of equal elements.
+ *
+ * @throws Runtime error if the array is empty.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::array<size_t, NDIM> argmin(const BasicArrayView<T, NDIM, ROW_MAJOR> &array)
+{
+	return argBest<false>(array, nullptr);
+}
+
+/**
+ * @brief Indexes of the minimum element on a thread pool.
+ *
+ * @throws Runtime error if the array is empty.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::array<size_t, NDIM> argmin(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool)
+{
+	return argBest<false>(array, &pool);
+}
+
+/**
+ * @brief Indexes of the maximum element, the first one in memory of equal elements.
+ *
+ * @throws Runtime error if the array is empty.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::array<size_t, NDIM> argmax(const BasicArrayView<T, NDIM, ROW_MAJOR> &array)
+{
+	return argBest<true>(array, nullptr);
+}
+
+/**
+ * @brief Indexes of the maximum element on a thread pool.
+ *
+ * @throws Runtime error if the array is empty.
+ */
+template<typename T, size_t NDIM, bool ROW_MAJOR>
+std::array<size_t, NDIM> argmax(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool)
+{
+	return argBest<true>(array, &pool);
+}
+
+/**
+ * @brief Sums along an axis, the result has the axis dropped.
+ */
+template<size_t AXIS, typename T, size_t NDIM, bool ROW_MAJOR>
+BasicArray<sum_t<T>, NDIM - 1> sum(const BasicArrayView<T, NDIM, ROW_MAJOR> &array,
+								   Summation summation = Summation::Fast)
+{
+	return reduceAlong<SumReduction<std::remove_const_t<T>>, AXIS>(array, summation, nullptr);
+}
+
+/**
+ * @brief Sums along an axis on a thread pool.
+ */
+template<size_t AXIS, typename T, size_t NDIM, bool ROW_MAJOR>
+BasicArray<sum_t<T>, NDIM - 1> sum(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool,
+								   Summation summation = Summation::Fast)
+{
+	return reduceAlong<SumReduction<std::remove_const_t<T>>, AXIS>(array, summation, &pool);
+}
+
+/**
+ * @brief Means along an axis, the result has the axis dropped.
+ */
+template<size_t AXIS, typename T, size_t NDIM, bool ROW_MAJOR>
+BasicArray<real_t<T>, NDIM - 1> mean(const BasicArrayView<T, NDIM, ROW_MAJOR> &array,
+									 Summation summation = Summation::Fast)
+{
+	return reduceAlong<MeanReduction<std::remove_const_t<T>>, AXIS>(array, summation, nullptr);
+}
+
+/**
+ * @brief Means along an axis on a thread pool.
+ */
+template<size_t AXIS, typename T, size_t NDIM, bool ROW_MAJOR>
+BasicArray<real_t<T>, NDIM - 1> mean(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool,
+									 Summation summation = Summation::Fast)
+{
+	return reduceAlong<MeanReduction<std::remove_const_t<T>>, AXIS>(array, summation, &pool);
+}
+
+/**
+ * @brief L2 norms along an axis, the result has the axis dropped.
+ */
+template<size_t AXIS, typename T, size_t NDIM, bool ROW_MAJOR>
+BasicArray<real_t<T>, NDIM - 1> norm2(const BasicArrayView<T, NDIM, ROW_MAJOR> &array,
+									  Summation summation = Summation::Fast)
+{
+	return reduceAlong<Norm2Reduction<std::remove_const_t<T>>, AXIS>(array, summation, nullptr);
+}
+
+/**
+ * @brief L2 norms along an axis on a thread pool.
+ */
+template<size_t AXIS, typename T, size_t NDIM, bool ROW_MAJOR>
+BasicArray<real_t<T>, NDIM - 1> norm2(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool,
+									  Summation summation = Summation::Fast)
+{
+	return reduceAlong<Norm2Reduction<std::remove_const_t<T>>, AXIS>(array, summation, &pool);
+}
+
+/**
+ * @brief Minimums along an axis, the result has the axis dropped.
+ */
+template<size_t AXIS, typename T, size_t NDIM, bool ROW_MAJOR>
+BasicArray<std::remove_const_t<T>, NDIM - 1> min(const BasicArrayView<T, NDIM, ROW_MAJOR> &array)
+{
+	return reduceAlong<MinReduction<std::remove_const_t<T>>, AXIS>(array, Summation::Fast, nullptr);
+}
+
+/**
+ * @brief Minimums along an axis on a thread pool.
+ */
+template<size_t AXIS, typename T, size_t NDIM, bool ROW_MAJOR>
+BasicArray<std::remove_const_t<T>, NDIM - 1> min(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool)
+{
+	return reduceAlong<MinReduction<std::remove_const_t<T>>, AXIS>(array, Summation::Fast, &pool);
+}
+
+/**
+ * @brief Maximums along an axis, the result has the axis dropped.
+ */
+template<size_t AXIS, typename T, size_t NDIM, bool ROW_MAJOR>
+BasicArray<std::remove_const_t<T>, NDIM - 1> max(const BasicArrayView<T, NDIM, ROW_MAJOR> &array)
+{
+	return reduceAlong<MaxReduction<std::remove_const_t<T>>, AXIS>(array, Summation::Fast, nullptr);
+}
+
+/**
+ * @brief Maximums along an axis on a thread pool.
+ */
+template<size_t AXIS, typename T, size_t NDIM, bool ROW_MAJOR>
+BasicArray<std::remove_const_t<T>, NDIM - 1> max(const BasicArrayView<T, NDIM, ROW_MAJOR> &array, ThreadPool &pool)
+{
+	return reduceAlong<MaxReduction<std::remove_const_t<T>>, AXIS>(array, Summation::Fast, &pool);
+}
+
+}
+
+#endif // REDUCTION_HPP
@@ -0,0 +1,826 @@
+/**
+ * @file
+ *
+ * @brief Strided Array View
+ *
+ * @details Zero-copy views on array slices.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef STRIDED_ARRAY_VIEW_HPP
+#define STRIDED_ARRAY_VIEW_HPP
+
+#include "BasicArrayView.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+/**
+ * @brief Slice range of a dimension: start, stop (exclusive) and step.
+ */
+struct Range
+{
+	/// Stop value meaning the end of the dimension.
+	constexpr static size_t END = std::numeric_limits<size_t>::max();
+
+	size_t start;
+	size_t stop;
+	size_t step;
+
+	/**
+	 * @brief The whole dimension.
+	 */
+	Range(): start(0), stop(END), step(1) {}
+
+	/**
+	 * @brief Elements start, start + step, ... below stop.
+	 */
+	Range(size_t start, size_t stop, size_t step = 1): start(start), stop(stop), step(step) {}
+};
+
+/**
+ * @brief Random access iterator visiting strided array elements in row-major order.
+ *
+ * @details Increments advance the innermost index and propagate the carry to the outer ones,
+ *          jumps recompute the indexes from the row-major position.
+ *          Iterators of one view are ordered by position, so standard and parallel algorithms
+ *          can split a range of any view, e.g. std::for_each(std::execution::par_unseq, ...).
+ *          Models std::random_access_iterator in C++20, so views are also ranges.
+ */
+template<typename ITER, size_t NDIM>
+class StridedIterator
+{
+public:
+
+	/// Type of shape container.
+	typedef std::array<size_t, NDIM> shape_t;
+
+	typedef std::random_access_iterator_tag iterator_category;
+	typedef std::remove_cv_t<std::remove_reference_t<decltype(*std::declval<ITER>())>> value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef decltype(*std::declval<ITER>()) reference;
+	typedef ITER pointer;
+
+	StridedIterator(): _data(), _iter(), _pos(0), _idx{0}, _shape{0}, _strides{0} {}
+
+	/**
+	 * @brief Iterator at the row-major position pos.
+	 */
+	StridedIterator(ITER data, const shape_t &shape, const shape_t &strides, size_t pos):
+		_data(data),
+		_iter(data),
+		_pos(0),
+		_idx{0},
+		_shape(shape),
+		_strides(strides)
+	{
+		seek(pos);
+	}
+
+	reference operator*() const
+	{
+		return *_iter;
+	}
+
+	pointer operator->() const
+	{
+		return _iter;
+	}
+
+	reference operator[](difference_type n) const
+	{
+		return *(*this + n);
+	}
+
+	StridedIterator& operator++()
+	{
+		_pos++;
+		for(size_t dim = NDIM; dim-- > 0;)
+		{
+			_iter += _strides[dim];
+			if(++_idx[dim] < _shape[dim] || !dim)
+				break;
+			_iter -= _strides[dim] * _shape[dim];
+			_idx[dim] = 0;
+		}
+		return *this;
+	}
+
+	StridedIterator operator++(int)
+	{
+		StridedIterator old(*this);
+		++*this;
+		return old;
+	}
+
+	StridedIterator& operator--()
+	{
+		_pos--;
+		for(size_t dim = NDIM; dim-- > 0;)
+		{
+			if(_idx[dim] || !dim)
+			{
+				_idx[dim]--;
+				_iter -= _strides[dim];
+				break;
+			}
+			_idx[dim] = _shape[dim] - 1;
+			_iter += _strides[dim] * _idx[dim];
+		}
+		return *this;
+	}
+
+	StridedIterator operator--(int)
+	{
+		StridedIterator old(*this);
+		--*this;
+		return old;
+	}
+
+	StridedIterator& operator+=(difference_type n)
+	{
+		seek(_pos + n);
+		return *this;
+	}
+
+	StridedIterator& operator-=(difference_type n)
+	{
+		seek(_pos - n);
+		return *this;
+	}
+
+	StridedIterator operator+(difference_type n) const
+	{
+		StridedIterator result(*this);
+		return result += n;
+	}
+
+	friend StridedIterator operator+(difference_type n, const StridedIterator &iter)
+	{
+		return iter + n;
+	}
+
+	StridedIterator operator-(difference_type n) const
+	{
+		StridedIterator result(*this);
+		return result -= n;
+	}
+
+	difference_type operator-(const StridedIterator &other) const
+	{
+		return static_cast<difference_type>(_pos - other._pos);
+	}
+
+	bool operator==(const StridedIterator &other) const
+	{
+		return _pos == other._pos;
+	}
+
+	bool operator!=(const StridedIterator &other) const
+	{
+		return _pos != other._pos;
+	}
+
+	bool operator<(const StridedIterator &other) const
+	{
+		return _pos < other._pos;
+	}
+
+	bool operator>(const StridedIterator &other) const
+	{
+		return _pos > other._pos;
+	}
+
+	bool operator<=(const StridedIterator &other) const
+	{
+		return _pos <= other._pos;
+	}
+
+	bool operator>=(const StridedIterator &other) const
+	{
+		return _pos >= other._pos;
+	}
+
+	/**
+	 * @brief Current array indexes.
+	 */
+	const shape_t& index() const
+	{
+		return _idx;
+	}
+
+	/**
+	 * @brief Current row-major position.
+	 */
+	size_t position() const
+	{
+		return _pos;
+	}
+
+private:
+	ITER _data;
+	ITER _iter;
+	size_t _pos;
+	shape_t _idx;
+	shape_t _shape;
+	shape_t _strides;
+
+	// Move to a row-major position, the end one having the first index past its dimension.
+	void seek(size_t pos)
+	{
+		_pos = pos;
+		_iter = _data;
+		_idx.fill(0);
+		for(size_t dim = NDIM; dim-- > 0 && pos;)
+		{
+			_idx[dim] = dim ? pos % _shape[dim] : pos;
+			_iter += _idx[dim] * _strides[dim];
+			pos /= _shape[dim];
+		}
+	}
+};
+
+#if __cplusplus >= 202002L
+static_assert(std::random_access_iterator<StridedIterator<float*, 3>>);
+static_assert(std::random_access_iterator<StridedIterator<const float*, 3>>);
+#endif
+
+/**
+ * @brief Strided Array View class.
+ *
+ * @details Views data with arbitrary strides, e.g. a slice of another array.
+ *          Elements are visited and copied in row-major order of the view indexes.
+ */
+template<typename T, size_t NDIM>
+class StridedArrayView: public ArrayBase<NDIM>
+{
+public:
+
+	/// This type.
+	typedef StridedArrayView<T, NDIM> this_t;
+	/// Base type.
+	typedef ArrayBase<NDIM> base_t;
+	/// Type of shape container.
+	typedef typename base_t::shape_t shape_t;
+	/// Data type.
+	typedef T data_t;
+	/// Iterator type.
+	typedef StridedIterator<T*, NDIM> iterator;
+	/// Constant iterator type.
+	typedef StridedIterator<const T*, NDIM> const_iterator;
+	/// Reference type.
+	typedef T& reference;
+	/// Constant reference type.
+	typedef const T& const_reference;
+
+	/**
+	 * @brief Public constructors.
+	 *
+	 * @details Strides are in number of elements.
+	 */
+	StridedArrayView(T *data, shape_t shape, shape_t strides):
+		base_t(std::move(shape), std::move(strides)),
+		_data(data)
+	{
+		if(!data)
+			throw std::runtime_error("Array view data pointer cannot be null.");
+	}
+
+	/**
+	 * @brief Get pointer to the first element.
+	 */
+	T* data() const
+	{
+		return _data;
+	}
+
+	/**
+	 * @brief Get begin iterator.
+	 */
+	iterator begin()
+	{
+		return iterator(_data, this->_shape, this->_strides, 0);
+	}
+
+	/**
+	 * @brief Get const begin iterator.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator(_data, this->_shape, this->_strides, 0);
+	}
+
+	/**
+	 * @brief Get end iterator.
+	 */
+	iterator end()
+	{
+		return iterator(_data, this->_shape, this->_strides, this->_size);
+	}
+
+	/**
+	 * @brief Get const end iterator.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator(_data, this->_shape, this->_strides, this->_size);
+	}
+
+	/**
+	 * @brief Computes element offset given array indexes.
+	 *
+	 * @details Hides the base version which assumes a unit last stride.
+	 */
+	template<typename... IDX>
+	size_t computeOffset(IDX... idx) const
+	{
+		static_assert(sizeof...(idx) == NDIM,
+				"Number of array indexes must be equal to number of dimensions.");
+
+		const shape_t index{static_cast<size_t>(idx)...};
+
+		size_t offset = 0;
+		for(size_t dim = 0; dim < NDIM; dim++)
+			offset += index[dim] * this->_strides[dim];
+		return offset;
+	}
+
+	/**
+	 * @brief Access elements of the array via indexes.
+	 */
+	template<typename... IDX>
+	reference operator()(IDX... idx)
+	{
+		return *(_data + computeOffset(idx...));
+	}
+
+	/**
+	 * @brief Access elements of the constant array via indexes.
+	 */
+	template<typename... IDX>
+	const_reference operator()(IDX... idx) const
+	{
+		return const_cast<this_t&>(*this)(idx...);
+	}
+
+	/**
+	 * @brief Subscript operator helper template.
+	 *
+	 * @details Supports subscript operator.
+	 */
+	template<typename ITER, typename REF, size_t DIM = 0>
+	class Subscript final
+	{
+	public:
+		Subscript<ITER, REF, DIM + 1> operator[](size_t idx)
+		{
+			const size_t stride = *(_strides++);
+			return Subscript<ITER, REF, DIM + 1>(_iter + idx * stride, _strides);
+		}
+
+	private:
+		ITER _iter;
+		const size_t *_strides;
+
+		Subscript(ITER iter, const size_t *strides): _iter(iter), _strides(strides) {}
+		Subscript(const Subscript&) = delete;
+		Subscript& operator=(const Subscript&) = delete;
+		friend class StridedArrayView;
+	};
+
+	/**
+	 * @brief Subscript operator helper template specialization.
+	 */
+	template<typename ITER, typename REF>
+	class Subscript<ITER, REF, NDIM - 1> final
+	{
+	public:
+		REF operator[](size_t idx)
+		{
+			return *(_iter + idx * *_strides);
+		}
+
+	private:
+		ITER _iter;
+		const size_t *_strides;
+
+		Subscript(ITER iter, const size_t *strides): _iter(iter), _strides(strides) {}
+		Subscript(const Subscript&) = delete;
+		Subscript& operator=(const Subscript&) = delete;
+		friend class StridedArrayView;
+	};
+
+	/**
+	 * @brief Subscript operator.
+	 */
+	std::conditional_t<NDIM == 1, reference, Subscript<T*, reference, 1>>
+	operator[](size_t idx)
+	{
+		const size_t *strides = this->_strides.data();
+		const size_t stride = *(strides++);
+
+		if constexpr (NDIM == 1)
+			return *(_data + idx * stride);
+		else
+			return Subscript<T*, reference, 1>(_data + idx * stride, strides);
+	}
+
+	/**
+	 * @brief Subscript operator.
+	 */
+	std::conditional_t<NDIM == 1, const_reference, Subscript<const T*, const_reference, 1>>
+	operator[](size_t idx) const
+	{
+		const size_t *strides = this->_strides.data();
+		const size_t stride = *(strides++);
+
+		if constexpr (NDIM == 1)
+			return *(_data + idx * stride);
+		else
+			return Subscript<const T*, const_reference, 1>(_data + idx * stride, strides);
+	}
+
+	/**
+	 * @brief Slice the view.
+	 *
+	 * @details Takes a Range or an index per dimension. An index drops the dimension.
+	 */
+	template<typename... ARGS>
+	auto slice(ARGS... args)
+	{
+		return makeSlice(_data, this->_shape, this->_strides, args...);
+	}
+
+	/**
+	 * @brief Slice the constant view.
+	 */
+	template<typename... ARGS>
+	auto slice(ARGS... args) const
+	{
+		return makeSlice(const_cast<const T*>(_data), this->_shape, this->_strides, args...);
+	}
+
+	/**
+	 * @brief Transpose the view.
+	 *
+	 * @details Dimension i of the result is dimension perm[i] of the view.
+	 *          Without arguments the order of the dimensions is reversed.
+	 */
+	template<typename... PERM>
+	auto transpose(PERM... perm)
+	{
+		return makeTranspose(_data, this->_shape, this->_strides, perm...);
+	}
+
+	/**
+	 * @brief Transpose the constant view.
+	 */
+	template<typename... PERM>
+	auto transpose(PERM... perm) const
+	{
+		return makeTranspose(const_cast<const T*>(_data), this->_shape, this->_strides, perm...);
+	}
+
+	/**
+	 * @brief Broadcast the view to a shape without copying.
+	 *
+	 * @details Dimensions are aligned at the end, as in NumPy. Dimensions of length 1
+	 *          and missing leading dimensions are repeated with zero strides.
+	 */
+	template<size_t ONDIM>
+	auto broadcast(const std::array<size_t, ONDIM> &shape) const
+	{
+		return makeBroadcast(const_cast<const T*>(_data), this->_shape, this->_strides, shape);
+	}
+
+	/**
+	 * @brief Traverse array indexes while calling a functor.
+	 */
+	template<typename FUN>
+	void traverse(FUN &&fun)
+	{
+		BasicArrayTraversal<T*, NDIM>(_data, shape_t{0}, this->_shape, this->_strides).
+				traverse(std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Traverse array indexes while calling a functor.
+	 */
+	template<typename FUN>
+	void traverse(FUN &&fun) const
+	{
+		BasicArrayTraversal<const T*, NDIM>(_data, shape_t{0}, this->_shape, this->_strides).
+				traverse(std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Traverse array elements while calling a functor without indexes.
+	 */
+	template<typename FUN>
+	void traverseValues(FUN &&fun)
+	{
+		BasicArrayTraversal<T*, NDIM>(_data, shape_t{0}, this->_shape, this->_strides).
+				traverseValues(std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Traverse array elements while calling a functor without indexes.
+	 */
+	template<typename FUN>
+	void traverseValues(FUN &&fun) const
+	{
+		BasicArrayTraversal<const T*, NDIM>(_data, shape_t{0}, this->_shape, this->_strides).
+				traverseValues(std::forward<FUN>(fun));
+	}
+
+	/**
+	 * @brief Traverse array indexes on a thread pool while calling a functor.
+	 *
+	 * @details The functor is called concurrently and must be safe to call from several threads.
+	 */
+	template<typename FUN>
+	void traverseParallel(FUN &&fun, util::ThreadPool &pool)
+	{
+		BasicArrayTraversal<T*, NDIM>(_data, shape_t{0}, this->_shape, this->_strides).
+				traverseParallel(std::forward<FUN>(fun), pool);
+	}
+
+	/**
+	 * @brief Traverse array indexes on a thread pool while calling a functor.
+	 *
+	 * @details The functor is called concurrently and must be safe to call from several threads.
+	 */
+	template<typename FUN>
+	void traverseParallel(FUN &&fun, util::ThreadPool &pool) const
+	{
+		BasicArrayTraversal<const T*, NDIM>(_data, shape_t{0}, this->_shape, this->_strides).
+				traverseParallel(std::forward<FUN>(fun), pool);
+	}
+
+	/**
+	 * @brief Comparison operator
+	 */
+	bool operator==(const this_t &other) const
+	{
+		if(this == &other)
+			return true;
+
+		if(this->_shape != other._shape)
+			return false;
+
+		const const_iterator thisIterEnd = end();
+		const_iterator thisIter = begin();
+		const_iterator otherIter = other.begin();
+
+		for(; thisIter != thisIterEnd && *thisIter == *otherIter; ++thisIter, ++otherIter);
+		return thisIter == thisIterEnd;
+	}
+
+	/**
+	 * @brief Copy data operator.
+	 *
+	 * @details
+	 *        Allows to copy only the data from a basic or a strided view.
+	 *        Reserve normal copy operator for copying the view while pointing to the same data.
+	 *        Views of the same shape are copied by a cache-oblivious kernel.
+	 *
+	 * @throws Runtime error of array sizes are unequal.
+	 */
+	template<typename OTHER>
+	std::enable_if_t<is_array_view_v<OTHER>, StridedArrayView&>
+	operator<<(const OTHER &other)
+	{
+		if(reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
+			return *this;
+
+		if(this->_size != other.size())
+			throw std::runtime_error("Cannot copy data: array sizes do not match.");
+
+		if constexpr (is_basic_array_view_v<OTHER> ||
+					  std::is_same_v<OTHER, StridedArrayView<typename OTHER::data_t, NDIM>>)
+		{
+			if constexpr (OTHER::ndim == NDIM)
+			{
+				if(this->_shape == other.shape())
+				{
+					util::stridedCopy(_data, this->_strides, &*other.begin(), other.strides(), this->_shape);
+					return *this;
+				}
+			}
+		}
+
+		auto otherIter = indexBegin(other);
+
+		traverseValues([&otherIter](T &data)
+		{
+			data = *otherIter;
+			++otherIter;
+		});
+
+		return *this;
+	}
+
+	/**
+	 * @brief Evaluate an expression into the view, e.g. s << b * 2 + c.
+	 *
+	 * @details A single pass without temporaries, see ArrayExpression.hpp.
+	 *
+	 * @throws Runtime error if the shapes differ.
+	 */
+	template<typename EXPR>
+	std::enable_if_t<is_array_expression_v<EXPR>, StridedArrayView&>
+	operator<<(const EXPR &expr)
+	{
+		assignExpression(_data, this->_shape, this->_strides, false, expr);
+		return *this;
+	}
+
+	/**
+	 * @brief Scientifically motivated comparing of stored values.
+	 *
+	 * @details Allows scientific number comparison without copying.
+	 *          Return false if array sizes differ.
+	 */
+	template<typename OTHER>
+	std::enable_if_t<is_array_view_v<OTHER>, bool>
+	equalValue(const OTHER &other) const
+	{
+		if(reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
+			return true;
+
+		if(this->_size != other.size())
+			return false;
+
+		const const_iterator thisIterEnd = end();
+		const_iterator thisIter = begin();
+		auto otherIter = indexBegin(other);
+
+		for(; thisIter != thisIterEnd && util::eq(*thisIter, *otherIter); ++thisIter, ++otherIter);
+		return thisIter == thisIterEnd;
+	}
+
+private:
+	T *_data;
+};
+
+/**
+ * @brief Slice strided data.
+ *
+ * @details Takes a Range or an index per dimension. An index drops the dimension.
+ *
+ * @throws Runtime error if a range is out of bounds or empty.
+ */
+template<typename T, size_t NDIM, typename... ARGS>
+auto makeSlice(T *data, const std::array<size_t, NDIM> &shape, const std::array<size_t, NDIM> &strides,
+			   ARGS... args)
+{
+	static_assert(sizeof...(args) == NDIM,
+			"Number of slice arguments must be equal to number of dimensions.");
+
+	constexpr size_t ONDIM = (std::is_same_v<ARGS, Range> + ...);
+	static_assert(ONDIM, "Slice must keep at least one dimension, use operator() to access an element.");
+
+	std::array<size_t, ONDIM> outShape;
+	std::array<size_t, ONDIM> outStrides;
+	size_t dim = 0;
+	size_t outDim = 0;
+
+	auto sliceDim = [&](auto arg)
+	{
+		if constexpr (std::is_same_v<decltype(arg), Range>)
+		{
+			const size_t stop = std::min(arg.stop, shape[dim]);
+
+			if(!arg.step)
+				throw std::runtime_error("Slice step cannot be zero.");
+			if(arg.start >= stop)
+				throw std::runtime_error("Slice range is out of bounds or empty.");
+
+			data += arg.start * strides[dim];
+			outShape[outDim] = (stop - arg.start + arg.step - 1) / arg.step;
+			outStrides[outDim] = strides[dim] * arg.step;
+			outDim++;
+		}
+		else
+		{
+			static_assert(std::is_integral_v<decltype(arg)>, "Slice argument must be a Range or an index.");
+
+			if(static_cast<size_t>(arg) >= shape[dim])
+				throw std::runtime_error("Slice index is out of bounds.");
+
+			data += arg * strides[dim];
+		}
+		dim++;
+	};
+
+	(sliceDim(args), ...);
+
+	return StridedArrayView<T, ONDIM>(data, outShape, outStrides);
+}
+
+/**
+ * @brief Transpose strided data.
+ *
+ * @details Dimension i of the result is dimension perm[i] of the data.
+ *          Without arguments the order of the dimensions is reversed.
+ *
+ * @throws Runtime error if the arguments are not a permutation of the dimensions.
+ */
+template<typename T, size_t NDIM, typename... PERM>
+auto makeTranspose(T *data, const std::array<size_t, NDIM> &shape, const std::array<size_t, NDIM> &strides,
+				   PERM... perm)
+{
+	static_assert(!sizeof...(perm) || sizeof...(perm) == NDIM,
+			"Number of transpose arguments must be zero or equal to number of dimensions.");
+
+	std::array<size_t, NDIM> order;
+	if constexpr (sizeof...(perm) == 0)
+	{
+		for(size_t i = 0; i < NDIM; i++)
+			order[i] = NDIM - 1 - i;
+	}
+	else
+		order = {static_cast<size_t>(perm)...};
+
+	std::array<bool, NDIM> seen{false};
+	std::array<size_t, NDIM> outShape;
+	std::array<size_t, NDIM> outStrides;
+
+	for(size_t i = 0; i < NDIM; i++)
+	{
+		if(order[i] >= NDIM || seen[order[i]])
+			throw std::runtime_error("Transpose arguments must be a permutation of the dimensions.");
+		seen[order[i]] = true;
+
+		outShape[i] = shape[order[i]];
+		outStrides[i] = strides[order[i]];
+	}
+
+	return StridedArrayView<T, NDIM>(data, outShape, outStrides);
+}
+
+/**
+ * @brief Get the common shape two shapes broadcast to.
+ *
+ * @details Dimensions are aligned at the end. Aligned dimensions must be equal
+ *          or one of them must have length 1; missing leading dimensions count as length 1.
+ *
+ * @throws Runtime error if the shapes are incompatible.
+ */
+template<size_t NDIM1, size_t NDIM2>
+std::array<size_t, std::max(NDIM1, NDIM2)> broadcastShape(const std::array<size_t, NDIM1> &shape1,
+														   const std::array<size_t, NDIM2> &shape2)
+{
+	constexpr size_t ONDIM = std::max(NDIM1, NDIM2);
+
+	std::array<size_t, ONDIM> outShape;
+	for(size_t dim = 0; dim < ONDIM; dim++)
+	{
+		const size_t len1 = dim + NDIM1 >= ONDIM ? shape1[dim + NDIM1 - ONDIM] : 1;
+		const size_t len2 = dim + NDIM2 >= ONDIM ? shape2[dim + NDIM2 - ONDIM] : 1;
+
+		if(len1 != len2 && len1 != 1 && len2 != 1)
+			throw std::runtime_error("Cannot broadcast array shapes: dimension lengths differ.");
+
+		outShape[dim] = len1 == 1 ? len2 : len1;
+	}
+	return outShape;
+}
+
+/**
+ * @brief Broadcast strided data to a shape.
+ *
+ * @details Repeated dimensions get zero strides, so the data is never expanded in memory.
+ *
+ * @throws Runtime error if the data cannot be broadcast to the shape.
+ */
+template<typename T, size_t NDIM, size_t ONDIM>
+auto makeBroadcast(const T *data, const std::array<size_t, NDIM> &shape, const std::array<size_t, NDIM> &strides,
+				   const std::array<size_t, ONDIM> &outShape)
+{
+	static_assert(ONDIM >= NDIM, "Cannot broadcast to fewer dimensions.");
+
+	std::array<size_t, ONDIM> outStrides{0};
+	for(size_t dim = ONDIM - NDIM; dim < ONDIM; dim++)
+	{
+		const size_t len = shape[dim + NDIM - ONDIM];
+
+		if(len == outShape[dim])
+			outStrides[dim] = strides[dim + NDIM - ONDIM];
+		else if(len != 1)
+			throw std::runtime_error("Cannot broadcast array: dimension lengths differ.");
+	}
+
+	return StridedArrayView<const T, ONDIM>(data, outShape, outStrides);
+}
+
+#endif // STRIDED_ARRAY_VIEW_HPP
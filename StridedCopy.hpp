@@ -0,0 +1,110 @@
+/**
+ * @file
+ *
+ * @brief Cache-oblivious copy between strided arrays.
+ *
+ * @details
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef STRIDED_COPY_HPP
+#define STRIDED_COPY_HPP
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+namespace util
+{
+
+/// Number of elements of a block copied by plain nested loops.
+constexpr size_t STRIDED_COPY_BLOCK_SIZE = 1024;
+
+// Copy a block with nested loops, the last dimension innermost.
+template<size_t DIM, typename DST, typename SRC, size_t NDIM>
+void copyBlock(DST dst, SRC src, const std::array<size_t, NDIM> &shape,
+			   const std::array<size_t, NDIM> &dstStrides, const std::array<size_t, NDIM> &srcStrides)
+{
+	const size_t n = shape[DIM];
+	const size_t dstStride = dstStrides[DIM];
+	const size_t srcStride = srcStrides[DIM];
+
+	for(size_t i = 0; i < n; i++, dst += dstStride, src += srcStride)
+	{
+		if constexpr (DIM == NDIM - 1)
+			*dst = *src;
+		else
+			copyBlock<DIM + 1>(dst, src, shape, dstStrides, srcStrides);
+	}
+}
+
+// Halve the longest dimension until a block fits in cache on both sides.
+template<typename DST, typename SRC, size_t NDIM>
+void copyRecursive(DST dst, SRC src, const std::array<size_t, NDIM> &shape, size_t size,
+				   const std::array<size_t, NDIM> &dstStrides, const std::array<size_t, NDIM> &srcStrides)
+{
+	if(size <= STRIDED_COPY_BLOCK_SIZE)
+	{
+		copyBlock<0>(dst, src, shape, dstStrides, srcStrides);
+		return;
+	}
+
+	const size_t dim = std::max_element(shape.begin(), shape.end()) - shape.begin();
+	const size_t half = shape[dim] / 2;
+
+	std::array<size_t, NDIM> first = shape;
+	first[dim] = half;
+	copyRecursive(dst, src, first, size / shape[dim] * half, dstStrides, srcStrides);
+
+	std::array<size_t, NDIM> second = shape;
+	second[dim] = shape[dim] - half;
+	copyRecursive(dst + half * dstStrides[dim], src + half * srcStrides[dim], second,
+				  size / shape[dim] * second[dim], dstStrides, srcStrides);
+}
+
+/**
+ * @brief Copy elements between arrays of the same shape and any strides.
+ *
+ * @details A cache-oblivious kernel: the shape is halved recursively until the blocks
+ *          of both arrays fit in cache, so transposing copies read and write whole cache lines.
+ *          Within a block the destination is written along its smallest stride.
+ */
+template<typename DST, typename SRC, size_t NDIM>
+void stridedCopy(DST dst, const std::array<size_t, NDIM> &dstStrides,
+				 SRC src, const std::array<size_t, NDIM> &srcStrides,
+				 const std::array<size_t, NDIM> &shape)
+{
+	// The order of dimensions does not matter to the copy, sort them by descending destination stride.
+	std::array<size_t, NDIM> order;
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&dstStrides](size_t a, size_t b)
+	{
+		return dstStrides[a] > dstStrides[b];
+	});
+
+	std::array<size_t, NDIM> sortedShape;
+	std::array<size_t, NDIM> sortedDstStrides;
+	std::array<size_t, NDIM> sortedSrcStrides;
+	size_t size = 1;
+	for(size_t i = 0; i < NDIM; i++)
+	{
+		sortedShape[i] = shape[order[i]];
+		sortedDstStrides[i] = dstStrides[order[i]];
+		sortedSrcStrides[i] = srcStrides[order[i]];
+		size *= shape[i];
+	}
+
+	copyRecursive(dst, src, sortedShape, size, sortedDstStrides, sortedSrcStrides);
+}
+
+}
+
+#endif // STRIDED_COPY_HPP
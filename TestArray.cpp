@@ -16,9 +16,24 @@
  * @par License: The MIT License (MIT)
  */
 #include "TestArray.hpp"
+#include "ArrayFile.hpp"
+#include "CacheInfo.hpp"
+#include "CowArray.hpp"
+#include "FixedArray.hpp"
+#include "MappedArray.hpp"
+#include "Numa.hpp"
+#include "Reduction.hpp"
 #include "Sentry.hpp"
+#include "TiledArray.hpp"
+#include "ZipTraversal.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <numeric>
+#include <utility>
 
 using namespace std;
 
@@ -28,7 +43,7 @@ namespace test
 //
 // Test access performance via optimized subscript operators.
 //
-void testArrayAccessMethod1(const test_shape_t &shape, float val)
+void testArrayAccessMethod1(const test_shape_t &shape, float val, util::Benchmark &bench)
 {
 	cout << "### Testing array access method 1 (subscript operators)." << endl;
 	cout << "Number of dimensions: " << shape.size() << endl;
@@ -36,9 +51,7 @@ void testArrayAccessMethod1(const test_shape_t &shape, float val)
 	BasicArray<float, NUM_TEST_DIM> a(shape);
 	cout << "Array size: " << a.size() << endl;
 
-	auto startTime = chrono::high_resolution_clock::now();
-
-	for(size_t t = 0; t < NUM_TEST_ITER; t++)
+	const auto &result = bench.run("subscript", "float", {shape.begin(), shape.end()}, a.size(), sizeof(float), [&a, val]
 	{
 		// loops are explicit in order to focus on the array access
 		for(size_t i0 = 0; i0 < a.dim<0>(); i0++)
@@ -54,17 +67,16 @@ void testArrayAccessMethod1(const test_shape_t &shape, float val)
 				}
 			}
 		}
-	}
+		util::doNotOptimize(*a.begin());
+	});
 
-	auto endTime = chrono::high_resolution_clock::now();
-	auto durationNanos = chrono::duration<double, nano>(endTime - startTime).count();
-    cout << "Method 1 write time: " << durationNanos/(NUM_TEST_ITER * a.size()) << " ns." << endl;
+	cout << "Method 1 write time: " << result << '.' << endl;
 }
 
 //
 // Test access performance via optimized variadic function template.
 //
-void testArrayAccessMethod2(const test_shape_t &shape, float val)
+void testArrayAccessMethod2(const test_shape_t &shape, float val, util::Benchmark &bench)
 {
 	cout << "### Testing array access method 2 (variadic function template)." << endl;
 	cout << "Number of dimensions: " << shape.size() << endl;
@@ -72,9 +84,7 @@ void testArrayAccessMethod2(const test_shape_t &shape, float val)
 	BasicArray<float, NUM_TEST_DIM> a(shape);
 	cout << "Array size: " << a.size() << endl;
 
-	auto startTime = chrono::high_resolution_clock::now();
-
-	for(size_t t = 0; t < NUM_TEST_ITER; t++)
+	const auto &result = bench.run("call", "float", {shape.begin(), shape.end()}, a.size(), sizeof(float), [&a, val]
 	{
 		// loops are explicit in order to focus on the array access
 		for(size_t i0 = 0; i0 < a.dim<0>(); i0++)
@@ -90,11 +100,721 @@ void testArrayAccessMethod2(const test_shape_t &shape, float val)
 				}
 			}
 		}
+		util::doNotOptimize(*a.begin());
+	});
+
+	cout << "Method 2 write time: " << result << '.' << endl;
+}
+
+//
+// Test array construction followed by a write pass, with and without initialization.
+//
+void testArrayConstruction(const test_shape_t &shape, float val, util::Benchmark &bench)
+{
+	cout << "### Testing array construction and a write pass." << endl;
+	cout << "Number of dimensions: " << shape.size() << endl;
+
+	const vector<size_t> shapeVec(shape.begin(), shape.end());
+	size_t size = 1;
+	for(size_t dimLen : shape)
+		size *= dimLen;
+	auto fill = [val](float &data){ data = val; };
+
+	cout << "Array size: " << size << endl;
+
+	const auto &init = bench.run("constructInit", "float", shapeVec, size, sizeof(float), [&shape, &fill]
+	{
+		BasicArray<float, NUM_TEST_DIM> a(shape);
+		a.traverseValues(fill);
+		util::doNotOptimize(*a.begin());
+	});
+	cout << "Initialized construction and write time: " << init << '.' << endl;
+
+	const auto &uninit = bench.run("constructUninitAligned", "float", shapeVec, size, sizeof(float), [&shape, &fill]
+	{
+		AlignedArray<float, NUM_TEST_DIM> a(shape, util::uninitialized);
+		a.traverseValues(fill);
+		util::doNotOptimize(*a.begin());
+	});
+	cout << "Uninitialized aligned construction and write time: " << uninit << '.' << endl;
+}
+
+// Expand the dimension tests.
+template<size_t... DIM>
+static void testTraversalDims(size_t targetSize, float val, util::Benchmark &bench, index_sequence<DIM...>)
+{
+	(testTraversalDim<DIM + 1>(targetSize, val, bench), ...);
+}
+
+//
+// Compare an index visitor functor with a hand-written loop nest for 1 to 8 dimensions.
+//
+void testTraversalDims(size_t targetSize, float val, util::Benchmark &bench)
+{
+	cout << "### Testing index visitor functor against a hand-written loop nest." << endl;
+	cout << "Array size: about " << targetSize << endl;
+
+	testTraversalDims(targetSize, val, bench, make_index_sequence<8>());
+}
+
+// Benchmark a sweep over all elements with the index of dimension 0 changing fastest.
+template<typename ARRAY>
+static const util::BenchmarkResult& benchmarkSweepDim0(util::Benchmark &bench, const string &name, ARRAY &a, float val)
+{
+	return bench.run(name, "float", {a.shape().begin(), a.shape().end()}, a.size(), sizeof(float), [&a, val]
+	{
+		if constexpr (ARRAY::ndim == 2)
+		{
+			for(size_t i1 = 0; i1 < a.template dim<1>(); i1++)
+				for(size_t i0 = 0; i0 < a.template dim<0>(); i0++)
+					a(i0, i1) += val;
+		}
+		else
+		{
+			for(size_t i2 = 0; i2 < a.template dim<2>(); i2++)
+				for(size_t i1 = 0; i1 < a.template dim<1>(); i1++)
+					for(size_t i0 = 0; i0 < a.template dim<0>(); i0++)
+						a(i0, i1, i2) += val;
+		}
+		util::doNotOptimize(*a.begin());
+	});
+}
+
+//
+// Compare tiled and row-major layouts on sweeps along the first dimension.
+//
+void testTiledLayout(size_t targetSize, float val, util::Benchmark &bench)
+{
+	cout << "### Testing tiled against row-major layout." << endl;
+
+	auto report = [](const util::BenchmarkResult &result){ cout << result << '.' << endl; };
+
+	{
+		const size_t len = static_cast<size_t>(round(sqrt(targetSize)));
+		BasicArray<float, 2> rowMajor({len, len});
+		TiledArray<float, 2> tiled({len, len}, {32, 32});
+
+		cout << "Column-wise sweep, row-major and tiled 32^2:" << endl;
+		report(benchmarkSweepDim0(bench, "sweepDim0", rowMajor, val));
+		report(benchmarkSweepDim0(bench, "tiledSweepDim0", tiled, val));
 	}
+	{
+		const size_t len = static_cast<size_t>(round(cbrt(targetSize)));
+		BasicArray<float, 3> rowMajor({len, len, len});
+		TiledArray<float, 3> tiled({len, len, len}, {8, 8, 8});
+
+		cout << "Plane-wise sweep, row-major and tiled 8^3:" << endl;
+		report(benchmarkSweepDim0(bench, "sweepDim0", rowMajor, val));
+		report(benchmarkSweepDim0(bench, "tiledSweepDim0", tiled, val));
+	}
+}
+
+//
+// Compare an element by element copy between layouts with the cache-oblivious copy.
+//
+void testTranspose(size_t targetSize, float val, util::Benchmark &bench)
+{
+	cout << "### Testing copy from row-major to column-major layout." << endl;
+
+	const size_t len = static_cast<size_t>(round(sqrt(targetSize)));
+	BasicArray<float, 2> rowMajor({len, len}, val);
+	LayoutArray<float, 2> columnMajor({len, len}, Layout<2>::columnMajor());
+
+	cout << "Element loop: " << bench.run("transposeLoop", "float", {len, len}, rowMajor.size(), 2 * sizeof(float),
+										  [&rowMajor, &columnMajor, len]
+	{
+		for(size_t i0 = 0; i0 < len; i0++)
+			for(size_t i1 = 0; i1 < len; i1++)
+				columnMajor(i0, i1) = rowMajor(i0, i1);
+		util::doNotOptimize(*columnMajor.begin());
+	}) << '.' << endl;
 
-	auto endTime = chrono::high_resolution_clock::now();
-	auto durationNanos = chrono::duration<double, nano>(endTime - startTime).count();
-    cout << "Method 2 write time: " << durationNanos/(NUM_TEST_ITER * a.size()) << " ns." << endl;
+	cout << "Cache-oblivious copy: " << bench.run("transposeCopy", "float", {len, len}, rowMajor.size(),
+												  2 * sizeof(float), [&rowMajor, &columnMajor]
+	{
+		columnMajor << rowMajor;
+		util::doNotOptimize(*columnMajor.begin());
+	}) << '.' << endl;
+}
+
+//
+// Compare a fused expression with temporaries and a hand-written traversal.
+//
+void testExpression(size_t targetSize, float val, util::Benchmark &bench)
+{
+	cout << "### Testing expression c << a * val + b." << endl;
+
+	const size_t len = static_cast<size_t>(round(sqrt(targetSize)));
+	BasicArray<float, 2> a({len, len}, 1);
+	BasicArray<float, 2> b({len, len}, 2);
+	BasicArray<float, 2> c({len, len});
+
+	auto report = [](const util::BenchmarkResult &result){ cout << result << '.' << endl; };
+
+	// one temporary per operation
+	report(bench.run("exprTemporaries", "float", {len, len}, c.size(), 3 * sizeof(float), [&a, &b, &c, val]
+	{
+		BasicArray<float, 2> tmp(a.shape());
+		tmp.traverse([&a, val](const auto &idx, float &data){ data = a(idx[0], idx[1]) * val; });
+		c.traverse([&tmp, &b](const auto &idx, float &data){ data = tmp(idx[0], idx[1]) + b(idx[0], idx[1]); });
+		util::doNotOptimize(*c.begin());
+	}));
+
+	report(bench.run("exprTraverse", "float", {len, len}, c.size(), 3 * sizeof(float), [&a, &b, &c, val]
+	{
+		c.traverse([&a, &b, val](const auto &idx, float &data){ data = a(idx[0], idx[1]) * val + b(idx[0], idx[1]); });
+		util::doNotOptimize(*c.begin());
+	}));
+
+	report(bench.run("expression", "float", {len, len}, c.size(), 3 * sizeof(float), [&a, &b, &c, val]
+	{
+		c << a * val + b;
+		util::doNotOptimize(*c.begin());
+	}));
+}
+
+//
+// Compare reductions with an accumulating traversal.
+//
+void testReduction(size_t targetSize, float val, util::ThreadPool &pool, util::Benchmark &bench)
+{
+	cout << "### Testing sum of all elements and along an axis." << endl;
+
+	const size_t len = static_cast<size_t>(round(sqrt(targetSize)));
+	BasicArray<float, 2> a({len, len}, val);
+
+	double traverseSum = 0;
+	double reduceSum = 0;
+	double parallelSum = 0;
+	double kahanSum = 0;
+	double axisSum = 0;
+
+	auto report = [](const util::BenchmarkResult &result){ cout << result << '.' << endl; };
+
+	// the array may change between calls, so the sums are not hoisted out of the loops
+	report(bench.run("sumTraverse", "float", {len, len}, a.size(), sizeof(float), [&a, &traverseSum]
+	{
+		util::doNotOptimize(*a.begin());
+		float sum = 0;
+		a.traverseValues([&sum](float data){ sum += data; });
+		traverseSum = sum;
+		util::doNotOptimize(traverseSum);
+	}));
+
+	report(bench.run("sum", "float", {len, len}, a.size(), sizeof(float), [&a, &reduceSum]
+	{
+		util::doNotOptimize(*a.begin());
+		reduceSum = util::sum(a);
+		util::doNotOptimize(reduceSum);
+	}));
+
+	report(bench.run("sumParallel", "float", {len, len}, a.size(), sizeof(float), [&a, &pool, &parallelSum]
+	{
+		util::doNotOptimize(*a.begin());
+		parallelSum = util::sum(a, pool);
+		util::doNotOptimize(parallelSum);
+	}));
+
+	report(bench.run("sumKahan", "float", {len, len}, a.size(), sizeof(float), [&a, &kahanSum]
+	{
+		util::doNotOptimize(*a.begin());
+		kahanSum = util::sum(a, util::Summation::Kahan);
+		util::doNotOptimize(kahanSum);
+	}));
+
+	report(bench.run("sumAxis0", "float", {len, len}, a.size(), sizeof(float), [&a, &axisSum]
+	{
+		util::doNotOptimize(*a.begin());
+		axisSum = util::sum<0>(a)[0];
+		util::doNotOptimize(axisSum);
+	}));
+
+	cout << "Sums: traversal " << traverseSum << ", reduction " << reduceSum << ", parallel " << parallelSum <<
+			", Kahan " << kahanSum << ", exact " << static_cast<double>(val) * a.size() << ", along axis 0 " <<
+			axisSum << '.' << endl;
+}
+
+//
+// Compare a broadcast expression with expanding the smaller operand to full size.
+//
+void testBroadcast(size_t targetSize, float val, util::Benchmark &bench)
+{
+	cout << "### Testing per-column scale c << a * scale." << endl;
+
+	const size_t len = static_cast<size_t>(round(sqrt(targetSize)));
+	BasicArray<float, 2> a({len, len}, val);
+	BasicArray<float, 1> scale({len}, 2);
+	BasicArray<float, 2> c({len, len});
+
+	cout << "Expanded operand: " << bench.run("broadcastExpanded", "float", {len, len}, c.size(), 3 * sizeof(float),
+											  [&a, &scale, &c]
+	{
+		BasicArray<float, 2> expanded(a.shape(), util::uninitialized);
+		expanded << scale.broadcast(a.shape());
+		c << a * expanded;
+		util::doNotOptimize(*c.begin());
+	}) << '.' << endl;
+
+	cout << "Broadcast: " << bench.run("broadcast", "float", {len, len}, c.size(), 2 * sizeof(float), [&a, &scale, &c]
+	{
+		c << a * scale;
+		util::doNotOptimize(*c.begin());
+	}) << '.' << endl;
+}
+
+// Benchmark an operation over a 2D shape and print its bandwidth in GB/s of the bytes read and written per element.
+template<typename FUN>
+static void benchmarkBandwidth(util::Benchmark &bench, const string &name, const string &type, size_t len,
+							   double bytes, FUN &&operation)
+{
+	const auto &result = bench.run(name, type, {len, len}, len * len, bytes, std::forward<FUN>(operation));
+	cout << result << ", " << bytes / result.median << " GB/s." << endl;
+}
+
+//
+// Compare copy bandwidth of an element loop with bulk copies.
+//
+void testBulkCopy(size_t targetSize, float val, util::ThreadPool &pool, util::Benchmark &bench)
+{
+	cout << "### Testing copy bandwidth." << endl;
+
+	const size_t len = static_cast<size_t>(round(sqrt(targetSize)));
+	BasicArray<float, 2> a({len, len}, val);
+	BasicArray<float, 2> b(a.shape());
+	BasicArray<int, 2> ints(a.shape(), 3);
+	BasicArray<double, 2> doubles(a.shape(), val);
+
+	benchmarkBandwidth(bench, "copyLoop", "float", len, 2 * sizeof(float), [&]{
+		b.traverse([&a](const auto &idx, float &data){ data = a(idx[0], idx[1]); });
+		util::doNotOptimize(*b.begin());
+	});
+	benchmarkBandwidth(bench, "copyBulk", "float", len, 2 * sizeof(float), [&]{
+		b << a;
+		util::doNotOptimize(*b.begin());
+	});
+	benchmarkBandwidth(bench, "copyParallel", "float", len, 2 * sizeof(float), [&]{
+		b.copyParallel(a, pool);
+		util::doNotOptimize(*b.begin());
+	});
+
+	// conversions to float
+	benchmarkBandwidth(bench, "copyBulk", "int32", len, sizeof(int) + sizeof(float), [&]{
+		b << ints;
+		util::doNotOptimize(*b.begin());
+	});
+	benchmarkBandwidth(bench, "copyBulk", "double", len, sizeof(double) + sizeof(float), [&]{
+		b << doubles;
+		util::doNotOptimize(*b.begin());
+	});
+	benchmarkBandwidth(bench, "copyParallel", "double", len, sizeof(double) + sizeof(float), [&]{
+		b.copyParallel(doubles, pool);
+		util::doNotOptimize(*b.begin());
+	});
+}
+
+//
+// Compare an element loop with vectorized exact and approximate comparison.
+//
+void testCompare(size_t targetSize, float val, util::Benchmark &bench)
+{
+	cout << "### Testing comparison bandwidth." << endl;
+
+	const size_t len = static_cast<size_t>(round(sqrt(targetSize)));
+	BasicArray<int, 2> a({len, len}, 3);
+	BasicArray<int, 2> b(a.shape(), 3);
+	BasicArray<unsigned, 2> u(a.shape(), 3);
+	BasicArray<float, 2> f(a.shape(), val);
+	BasicArray<double, 2> d(a.shape(), val);
+	const size_t n = a.size();
+	bool equal = true;
+
+	// the compared arrays may change between calls, so the comparisons are not hoisted out of the loops
+	auto touch = [](auto &x, auto &y){ util::doNotOptimize(*x.begin()); util::doNotOptimize(*y.begin()); };
+
+	benchmarkBandwidth(bench, "compareLoop", "int32", len, 2 * sizeof(int), [&]{
+		touch(a, u);
+		size_t i = 0;
+		for(; i < n && util::eq(a.begin()[i], u.begin()[i]); i++);
+		equal &= i == n;
+	});
+	benchmarkBandwidth(bench, "compareSame", "int32", len, 2 * sizeof(int), [&]{ touch(a, b); equal &= a == b; });
+	benchmarkBandwidth(bench, "compareMixed", "int32", len, 2 * sizeof(int), [&]{
+		touch(a, u);
+		equal &= a.equalValue(u);
+	});
+	benchmarkBandwidth(bench, "compareApprox", "float", len, sizeof(float) + sizeof(double), [&]{
+		touch(f, d);
+		equal &= bool(f.approxEqual(d, 0, 1e-6, 4));
+	});
+
+	if(!equal)
+		cout << "Bad comparison." << endl;
+}
+
+//
+// Measure the cost of the instrumentation hooks on calls over few elements.
+//
+void testInstrumentation(float val, util::Benchmark &bench)
+{
+	cout << "### Testing instrumentation overhead (" <<
+			(util::Instrumentation::enabled() ? "enabled" : "disabled") << ")." << endl;
+
+	BasicArray<float, 2> a({4, 4});
+
+	// one element per call, so the times are per call
+	cout << "Per traverseValues() call: " << bench.run("traverseValuesCall", "float", {4, 4}, 1, [&a, val]
+	{
+		a.traverseValues([val](float &data){ data = val; });
+		util::doNotOptimize(*a.begin());
+	}) << '.' << endl;
+}
+
+//
+// Compare cloning a basic array with cloning a copy-on-write array, read only and written.
+//
+void testCopyOnWrite(size_t targetSize, float val, util::Benchmark &bench)
+{
+	cout << "### Testing copy-on-write clones." << endl;
+
+	const size_t len = static_cast<size_t>(round(sqrt(targetSize)));
+	BasicArray<float, 2> a({len, len}, val);
+	CowArray<float, 2> cow(a);
+
+	// one element per clone, so the times are per clone
+	auto benchmarkClones = [&bench, len, val](const string &name, auto &array, bool write)
+	{
+		cout << bench.run(name, "float", {len, len}, 1, [&array, write, val]
+		{
+			auto clone = array.cloneT();
+			if(write)
+				(*clone)(0, 0) = val;
+			util::doNotOptimize(std::as_const(*clone)(0, 0));
+		}) << '.' << endl;
+	};
+
+	benchmarkClones("cloneBasic", a, false);
+	benchmarkClones("cloneCow", cow, false);
+	benchmarkClones("cloneCowWritten", cow, true);
+}
+
+// Memory resource counting the allocations passed to the default resource.
+class CountingResource: public std::pmr::memory_resource
+{
+public:
+	size_t allocations = 0;
+
+private:
+	void* do_allocate(size_t bytes, size_t alignment) override
+	{
+		allocations++;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void *ptr, size_t bytes, size_t alignment) override
+	{
+		std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+//
+// Count heap allocations and time of small arrays with and without inline storage.
+//
+void testSmallArrays(float val, util::Benchmark &bench)
+{
+	cout << "### Testing small arrays." << endl;
+
+	typedef std::pmr::polymorphic_allocator<double> alloc_t;
+
+	auto benchmarkArrays = [&bench, val](auto *tag)
+	{
+		typedef remove_pointer_t<decltype(tag)> array_t;
+
+		// copies allocate from the default resource
+		CountingResource resource;
+		std::pmr::memory_resource *defaultResource = std::pmr::set_default_resource(&resource);
+
+		// a 3x3 matrix and a copy of it, timed per pair
+		auto makeArrays = [&resource, val]
+		{
+			array_t a({3, 3}, val, &resource);
+			array_t b = a;
+			util::doNotOptimize(b(2, 2));
+		};
+
+		makeArrays();
+		const size_t allocations = resource.allocations;
+		const auto &result = bench.run(array_t::INLINE_CAPACITY ? "smallInline" : "smallHeap", "double", {3, 3}, 1,
+									   makeArrays);
+		std::pmr::set_default_resource(defaultResource);
+
+		cout << allocations << " allocations per array and copy, " << result << '.' << endl;
+	};
+
+	benchmarkArrays(static_cast<BasicArray<double, 2, alloc_t, 0>*>(nullptr));
+	benchmarkArrays(static_cast<BasicArray<double, 2, alloc_t>*>(nullptr));
+}
+
+//
+// Compare growing a vector of arrays by moves with copies.
+//
+void testArrayMoves(size_t targetSize, float val, util::Benchmark &bench)
+{
+	cout << "### Testing array moves." << endl;
+
+	constexpr size_t NUM_ARRAYS = 64;
+	const size_t len = static_cast<size_t>(round(sqrt(targetSize / NUM_ARRAYS)));
+	const BasicArray<float, 2> a({len, len}, val);
+	vector<BasicArray<float, 2>> sources(NUM_ARRAYS, a);
+
+	cout << NUM_ARRAYS << " arrays, times per push_back of a copy and of a move:" << endl;
+
+	cout << bench.run("pushBackCopy", "float", {len, len}, NUM_ARRAYS, [&sources]
+	{
+		vector<BasicArray<float, 2>> arrays;
+		for(auto &source : sources)
+			arrays.push_back(source);
+		util::doNotOptimize(arrays.back());
+	}) << '.' << endl;
+
+	// the moved arrays become the sources of the next iteration
+	cout << bench.run("pushBackMove", "float", {len, len}, NUM_ARRAYS, [&sources]
+	{
+		vector<BasicArray<float, 2>> arrays;
+		for(auto &source : sources)
+			arrays.push_back(std::move(source));
+		util::doNotOptimize(arrays.back());
+		sources.swap(arrays);
+	}) << '.' << endl;
+}
+
+//
+// Compare a traversal of a strided slice with standard algorithms on its iterators.
+//
+void testStandardAlgorithms(size_t targetSize, float val, util::Benchmark &bench)
+{
+	cout << "### Testing standard algorithms on every other column." << endl;
+
+	const size_t len = static_cast<size_t>(round(sqrt(targetSize)));
+	BasicArray<float, 2> a({len, len}, val);
+	auto s = a.slice(Range(), Range(0, Range::END, 2));
+
+	cout << "Traversal: " << bench.run("sliceTraverse", "float", {len, len / 2}, s.size(), sizeof(float), [&s]
+	{
+		s.traverse([](float &data){ data = data * 0.5f + 1; });
+		util::doNotOptimize(*s.begin());
+	}) << '.' << endl;
+
+	cout << "std::transform: " << bench.run("sliceTransform", "float", {len, len / 2}, s.size(), sizeof(float), [&s]
+	{
+		std::transform(s.begin(), s.end(), s.begin(), [](float data){ return data * 0.5f + 1; });
+		util::doNotOptimize(*s.begin());
+	}) << '.' << endl;
+
+	// a jump recomputes the indexes
+	cout << "Random access: " << bench.run("sliceJump", "float", {len, len / 2}, (s.size() + 6) / 7, sizeof(float),
+										   [&s]
+	{
+		const auto first = s.begin();
+		double sum = 0;
+		for(size_t i = 0; i < s.size(); i += 7)
+			sum += first[i];
+		util::doNotOptimize(sum);
+	}) << '.' << endl;
+}
+
+//
+// Compare a traversal indexing the other arrays with lock-step traversals.
+//
+void testZipTraversal(size_t targetSize, float val, util::Benchmark &bench)
+{
+	cout << "### Testing zip traversal c = a * val + b." << endl;
+
+	const size_t len = static_cast<size_t>(round(sqrt(targetSize)));
+	const BasicArray<float, 2> a({len, len}, 1);
+	const BasicArray<double, 2> b({len, len}, 2);
+	BasicArray<float, 2> c({len, len});
+	const size_t bytes = 2 * sizeof(float) + sizeof(double);
+
+	cout << "Indexing traversal: " << bench.run("zipIndexing", "float", {len, len}, c.size(), bytes,
+												[&a, &b, &c, val]
+	{
+		c.traverse([&a, &b, val](const auto &idx, float &data){
+			data = a(idx[0], idx[1]) * val + b(idx[0], idx[1]);
+		});
+		util::doNotOptimize(*c.begin());
+	}) << '.' << endl;
+
+	cout << "Zip: " << bench.run("zip", "float", {len, len}, c.size(), bytes, [&a, &b, &c, val]
+	{
+		zipTraverse([val](const auto&, float &cData, float aData, double bData){
+			cData = aData * val + bData;
+		}, c, a, b);
+		util::doNotOptimize(*c.begin());
+	}) << '.' << endl;
+
+	cout << "Zip without indexes: " << bench.run("zipValues", "float", {len, len}, c.size(), bytes,
+												 [&a, &b, &c, val]
+	{
+		zipTraverse([val](float &cData, float aData, double bData){ cData = aData * val + bData; }, c, a, b);
+		util::doNotOptimize(*c.begin());
+	}) << '.' << endl;
+}
+
+//
+// Compare a transposing traversal with tiled ones.
+//
+void testTiledTraversal(size_t targetSize, float val, util::Benchmark &bench)
+{
+	cout << "### Testing tiled traversal b(i, j) = a(j, i)." << endl;
+
+	const size_t len = static_cast<size_t>(round(sqrt(targetSize)));
+	const BasicArray<float, 2> a({len, len}, val);
+	BasicArray<float, 2> b({len, len});
+	auto transpose = [&a](const auto &idx, float &data){ data = a(idx[1], idx[0]); };
+
+	const util::CacheSizes &caches = util::cacheSizes();
+	const auto autoTile = BasicArrayTraversal<float*, 2>::autoTileShape(sizeof(float));
+
+	cout << "Caches L1 " << (caches.l1 >> 10) << " KiB, L2 " << (caches.l2 >> 10) << " KiB, line " <<
+			caches.lineSize << " bytes." << endl;
+
+	cout << "Traversal: " << bench.run("transposeTraverse", "float", {len, len}, b.size(), 2 * sizeof(float),
+									   [&b, &transpose]
+	{
+		b.traverse(transpose);
+		util::doNotOptimize(*b.begin());
+	}) << '.' << endl;
+
+	cout << "16x16 tiles: " << bench.run("transposeTiled16", "float", {len, len}, b.size(), 2 * sizeof(float),
+										 [&b, &transpose]
+	{
+		b.traverseTiled(transpose, {16, 16});
+		util::doNotOptimize(*b.begin());
+	}) << '.' << endl;
+
+	cout << "Auto " << autoTile[0] << "x" << autoTile[1] << " tiles: " <<
+			bench.run("transposeTiledAuto", "float", {len, len}, b.size(), 2 * sizeof(float), [&b, &transpose]
+	{
+		b.traverseTiled(transpose);
+		util::doNotOptimize(*b.begin());
+	}) << '.' << endl;
+}
+
+// Nested loops over all indexes of a shape, the last index innermost.
+template<size_t DIM = 0, size_t NDIM, typename FUN>
+static void forEachIndex(const array<size_t, NDIM> &shape, array<size_t, NDIM> &idx, FUN &&fun)
+{
+	for(idx[DIM] = 0; idx[DIM] < shape[DIM]; idx[DIM]++)
+	{
+		if constexpr (DIM == NDIM - 1)
+			fun(idx);
+		else
+			forEachIndex<DIM + 1>(shape, idx, fun);
+	}
+}
+
+// Element of an array via chained subscript operators.
+template<size_t DIM = 0, typename A, size_t NDIM>
+static decltype(auto) subscript(A &&a, const array<size_t, NDIM> &idx)
+{
+	if constexpr (DIM == NDIM)
+		return a;
+	else
+		return subscript<DIM + 1>(a[idx[DIM]], idx);
+}
+
+// View of every other element along the last dimension.
+template<typename ARRAY, size_t... DIM>
+static auto sliceEveryOther(ARRAY &a, index_sequence<DIM...>)
+{
+	return a.slice((DIM == sizeof...(DIM) - 1 ? Range(0, Range::END, 2) : Range())...);
+}
+
+// Benchmark the access methods and views of a hypercube array with about targetSize elements.
+template<typename T, size_t NDIM>
+static void benchmarkAccess(util::Benchmark &bench, size_t targetSize)
+{
+	array<size_t, NDIM> shape;
+	shape.fill(static_cast<size_t>(round(pow(targetSize, 1.0 / NDIM))));
+	const vector<size_t> shapeVec(shape.begin(), shape.end());
+	const string type = typeName<T>();
+	const T val = 3;
+
+	BasicArray<T, NDIM> a(shape, 1);
+
+	auto report = [](const util::BenchmarkResult &result){ cout << result << '.' << endl; };
+
+	report(bench.run("subscript", type, shapeVec, a.size(), sizeof(T), [&a, &shape, val]
+	{
+		array<size_t, NDIM> idx;
+		forEachIndex(shape, idx, [&a, val](const auto &idx){ subscript(a, idx) = val; });
+		util::doNotOptimize(*a.begin());
+	}));
+
+	report(bench.run("call", type, shapeVec, a.size(), sizeof(T), [&a, &shape, val]
+	{
+		array<size_t, NDIM> idx;
+		forEachIndex(shape, idx, [&a, val](const auto &idx)
+		{
+			apply([&a](auto... i) -> T& { return a(i...); }, idx) = val;
+		});
+		util::doNotOptimize(*a.begin());
+	}));
+
+	report(bench.run("traverse", type, shapeVec, a.size(), sizeof(T), [&a, val]
+	{
+		a.traverse([val](const auto&, T &data){ data = val; });
+		util::doNotOptimize(*a.begin());
+	}));
+
+	report(bench.run("traverseValues", type, shapeVec, a.size(), sizeof(T), [&a, val]
+	{
+		a.traverseValues([val](T &data){ data = val; });
+		util::doNotOptimize(*a.begin());
+	}));
+
+	auto slice = sliceEveryOther(a, make_index_sequence<NDIM>());
+
+	report(bench.run("slice", type, shapeVec, slice.size(), sizeof(T), [&a, &slice, val]
+	{
+		slice.traverse([val](const auto&, T &data){ data = val; });
+		util::doNotOptimize(*a.begin());
+	}));
+
+	auto transposed = a.transpose();
+
+	report(bench.run("transpose", type, shapeVec, a.size(), sizeof(T), [&a, &transposed, val]
+	{
+		transposed.traverse([val](const auto&, T &data){ data = val; });
+		util::doNotOptimize(*a.begin());
+	}));
+}
+
+template<typename T, size_t... DIM>
+static void benchmarkAccess(util::Benchmark &bench, size_t targetSize, index_sequence<DIM...>)
+{
+	(benchmarkAccess<T, DIM + 1>(bench, targetSize), ...);
+}
+
+//
+// Benchmark access methods and views over element types, dimensions and shapes.
+//
+void benchmarkAccess(util::Benchmark &bench)
+{
+	cout << "### Benchmarking access methods and views." << endl;
+
+	// cache-resident and DRAM-sized arrays
+	for(size_t targetSize : {size_t(1) << 14, size_t(1) << 24})
+	{
+		benchmarkAccess<float>(bench, targetSize, make_index_sequence<4>());
+		benchmarkAccess<double>(bench, targetSize, make_index_sequence<4>());
+		benchmarkAccess<int32_t>(bench, targetSize, make_index_sequence<4>());
+	}
 }
 
 // Examples of array view code.
@@ -166,6 +886,587 @@ void demoBasicArrayView()
 			cout << "Bad clone." << endl;
 
 	}
+	// clones share the buffer until written
+	{
+		BasicArray<int, 2> a({30, 40});
+		a.traverse([](const auto &idx, int &data){ data = idx[0] * 100 + idx[1]; });
+
+		CowArray<int, 2> snapshot(a);
+		auto clone = snapshot.cloneT();
+		const bool sharedOnClone = clone->shared() && std::as_const(*clone).begin() == std::as_const(snapshot).begin();
+
+		// the clone gets a buffer of its own, the snapshot keeps its values
+		(*clone)(3, 4) = -1;
+
+		// moves leave the source without the buffer
+		CowArray<int, 2> moved(std::move(*clone));
+		const bool movedOut = clone->size() == 0 && clone->data() == nullptr;
+
+		if(sharedOnClone && movedOut && !moved.shared() && !snapshot.shared() && snapshot.equalValue(a) &&
+				std::as_const(moved)(3, 4) == -1 && std::as_const(moved)(3, 5) == 305)
+			cout << "Good copy-on-write." << endl;
+		else
+			cout << "Bad copy-on-write." << endl;
+	}
+	// copies own their buffers, moves transfer them without copying
+	{
+		const int *factoryData = nullptr;
+		auto makeArray = [&factoryData](int value)
+		{
+			BasicArray<int, 2> a({20, 30}, value);
+			factoryData = a.data();
+			return a;
+		};
+
+		BasicArray<int, 2> a = makeArray(1);
+		const bool factoryMoved = a.data() == factoryData;
+
+		BasicArray<int, 2> copy = a;
+		copy(0, 0) = 2;
+		const bool ownBuffer = copy.data() != a.data() && a(0, 0) == 1 && a.cloneT()->data() != a.data();
+
+		// reallocation of the vector moves the arrays
+		const int *data = a.data();
+		vector<BasicArray<int, 2>> arrays;
+		arrays.push_back(move(a));
+		for(int i = 0; i < 10; i++)
+			arrays.push_back(makeArray(i));
+		const bool vectorMoved = arrays[0].data() == data && !a.size();
+
+		// copy assignment of the same size reuses the buffer
+		const int *copyData = copy.data();
+		copy = arrays[1];
+		const bool reused = copy.data() == copyData && copy.equalValue(arrays[1]);
+
+		swap(copy, arrays[0]);
+
+		if(factoryMoved && ownBuffer && vectorMoved && reused && copy.data() == data && arrays[0].data() == copyData)
+			cout << "Good moves." << endl;
+		else
+			cout << "Bad moves." << endl;
+	}
+	// zero-copy strided slices
+	{
+		BasicArray<int, 3> a({4, 5, 6});
+
+		a.traverse([](const auto &idx, int &data){
+			data = idx[0] * 100 + idx[1] * 10 + idx[2];
+		});
+
+		// every other plane, fixed row, every third column
+		auto s = a.slice(Range(1, 4, 2), 2, Range(0, Range::END, 3));
+
+		bool good = s.shape() == array<size_t, 2>{2, 2};
+		s.traverse([&good](const auto &idx, int &data){
+			good = good && data == static_cast<int>((1 + idx[0] * 2) * 100 + 20 + idx[1] * 3);
+		});
+
+		// copy the slice out and back in
+		BasicArray<float, 2> b(s.shape());
+		b << s;
+		s << b;
+
+		if(good && s(1, 1) == 323 && s[1][1] == 323 && b.equalValue(s) && s.equalValue(b))
+			cout << "Good slice." << endl;
+		else
+			cout << "Bad slice." << endl;
+	}
+	// value traversal of views whose dimensions partly collapse
+	{
+		BasicArray<int, 4> a({3, 1, 4, 5});
+		std::iota(a.begin(), a.end(), 0);
+
+		// the last two dimensions merge, the first does not, the second has unit length
+		auto partial = a.slice(Range(), Range(), Range(1, 3), Range());
+		// unit length last dimension, nothing merges across the strided third one
+		auto strided = a.slice(Range(0, 3, 2), Range(), Range(0, 4, 3), Range(2, 3));
+
+		auto sameOrder = [](auto &view)
+		{
+			vector<int*> indexed;
+			vector<int*> values;
+			view.traverse([&indexed](const auto&, int &data){ indexed.push_back(&data); });
+			view.traverseValues([&values](int &data){ values.push_back(&data); });
+			return indexed == values && indexed.size() == view.size();
+		};
+
+		if(sameOrder(partial) && sameOrder(strided) && sameOrder(a))
+			cout << "Good value traversal." << endl;
+		else
+			cout << "Bad value traversal." << endl;
+	}
+	// standard algorithms on N-d iterators
+	{
+		BasicArray<int, 3> a({3, 4, 5});
+		std::iota(a.begin(), a.end(), 0);
+
+		// sort a strided slice descending, in place
+		auto s = a.slice(Range(0, 3, 2), Range(1, 4), Range(0, 5, 2));
+		std::sort(s.begin(), s.end(), std::greater<int>());
+		const bool sorted = std::is_sorted(s.begin(), s.end(), std::greater<int>()) &&
+				s(0, 0, 0) == 59 && s(1, 2, 2) == 5 && s.end() - s.begin() == 18;
+
+		// indexes of a found element and jumps back and forth
+		LayoutArray<int, 2> fortran({4, 6}, Layout<2>::columnMajor());
+		fortran.traverse([](const auto &idx, int &data){ data = static_cast<int>(idx[0] * 10 + idx[1]); });
+		auto found = std::find(fortran.indexBegin(), fortran.indexEnd(), 32);
+		auto last = fortran.indexEnd() - 1;
+
+		vector<int> doubled(fortran.size());
+		std::transform(fortran.indexBegin(), fortran.indexEnd(), doubled.begin(), [](int x){ return 2 * x; });
+
+		if(sorted && found.index() == array<size_t, 2>{3, 2} && found.position() == 20 &&
+		   *last == 35 && last[-9] == 22 && (found + 3 == last) && *--found == 31 && doubled[7] == 22)
+			cout << "Good standard algorithms." << endl;
+		else
+			cout << "Bad standard algorithms." << endl;
+	}
+	// fixed arrays with compile time shape and inline storage
+	{
+		FixedArray<int, 3, 3, 3> stencil;
+
+		stencil.traverse([](const auto &idx, int &data){
+			data = idx[0] * 100 + idx[1] * 10 + idx[2];
+		});
+
+		// interoperate with basic arrays
+		BasicArray<long, 2> a({9, 3});
+		a << stencil;
+
+		FixedArray<double, 27> flat;
+		flat << a;
+
+		if(stencil(2, 1, 0) == 210 && stencil[2][1][0] == 210 && a.equalValue(stencil) &&
+		   flat.equalValue(stencil) && stencil.equalValue(a))
+			cout << "Good fixed array." << endl;
+		else
+			cout << "Bad fixed array." << endl;
+	}
+	// allocator-aware storage
+	{
+		AlignedArray<float, 2, 128> aligned({7, 9}, util::uninitialized);
+		aligned.traverseValues([](float &data){ data = 1; });
+
+		char buf[1024];
+		std::pmr::monotonic_buffer_resource resource(buf, sizeof(buf));
+		PmrArray<int, 2> pmr({7, 9}, 1, &resource);
+
+		const bool inBuffer = reinterpret_cast<char*>(pmr.begin()) >= buf &&
+							  reinterpret_cast<char*>(pmr.end()) <= buf + sizeof(buf);
+
+		if(reinterpret_cast<uintptr_t>(aligned.begin()) % 128 == 0 && inBuffer && aligned.equalValue(pmr))
+			cout << "Good allocators." << endl;
+		else
+			cout << "Bad allocators." << endl;
+	}
+	// small arrays keep their elements inline without allocating
+	{
+		// copies allocate from the default resource
+		CountingResource resource;
+		std::pmr::memory_resource *defaultResource = std::pmr::set_default_resource(&resource);
+		util::Sentry resourceSentry([defaultResource]{ std::pmr::set_default_resource(defaultResource); });
+
+		PmrArray<double, 2> matrix({4, 4}, 1.5, &resource);
+		PmrArray<double, 2> copy = matrix;
+		PmrArray<double, 2> moved = move(copy);
+		copy = matrix;
+		const size_t smallAllocations = resource.allocations;
+
+		PmrArray<double, 2> large({5, 4}, 1.5, &resource);
+
+		if(matrix.isInline() && !smallAllocations && resource.allocations == 1 && !large.isInline() &&
+				moved.equalValue(matrix) && copy.equalValue(large.slice(Range(0, 4), Range())))
+			cout << "Good inline storage." << endl;
+		else
+			cout << "Bad inline storage." << endl;
+	}
+	// arrays on memory-mapped files
+	{
+		const string path = (filesystem::temp_directory_path() / "CppSampleMappedArray.bin").string();
+		util::Sentry fileSentry([&path]{ filesystem::remove(path); });
+
+		BasicArray<int, 2> a({10, 20});
+		a.traverse([](const auto &idx, int &data){
+			data = idx[0] * 100 + idx[1];
+		});
+
+		{
+			MappedArray<int, 2> shared(path, a.shape(), MappedArray<int, 2>::Mode::Shared);
+			shared << a;
+			shared.sync();
+		}
+
+		MappedArray<const int, 2> readOnly(path, a.shape());
+		readOnly.advise(MappedArray<const int, 2>::Advice::Sequential);
+
+		// last row via a byte offset
+		MappedArray<const int, 1> row(path, {20}, MappedArray<const int, 1>::Mode::ReadOnly, 9 * 20 * sizeof(int));
+
+		if(a.equalValue(readOnly) && row(5) == 905)
+			cout << "Good mapped array." << endl;
+		else
+			cout << "Bad mapped array." << endl;
+	}
+	// binary array files
+	{
+		const string path = (filesystem::temp_directory_path() / "CppSampleArrayFile.npy").string();
+		util::Sentry fileSentry([&path]{ filesystem::remove(path); });
+
+		BasicArray<double, 3> a({6, 4, 5});
+		a.traverse([](const auto &idx, double &data){
+			data = idx[0] * 100 + idx[1] * 10 + idx[2] + 0.5;
+		});
+
+		saveArray(path, a);
+
+		BasicArray<double, 3> loaded(a.shape(), util::uninitialized);
+		loadArray(path, loaded);
+
+		// stream the array back slab by slab
+		{
+			ArrayWriter<double, 3> writer(path, a.shape());
+			for(size_t i = 0; i < a.dim<0>(); i += 2)
+				writer.write(BasicArrayView<double, 3>(&a(i, 0, 0), {2, 4, 5}));
+			writer.close();
+		}
+
+		ArrayReader<double, 3> reader(path);
+		BasicArray<double, 3> slab({3, 4, 5});
+		reader.read(slab).read(slab);
+
+		// map the data behind the header
+		MappedArray<const double, 3> mapped(path, reader.shape(), MappedArray<const double, 3>::Mode::ReadOnly,
+				reader.dataOffset());
+
+		if(a.equalValue(loaded) && slab(2, 3, 4) == 534.5 && a.equalValue(mapped))
+			cout << "Good array file." << endl;
+		else
+			cout << "Bad array file." << endl;
+	}
+	// tiled storage layout
+	{
+		TiledArray<int, 3> tiled({10, 7, 9}, {4, 4, 4});
+
+		tiled.traverse([](const auto &idx, int &data){
+			data = idx[0] * 100 + idx[1] * 10 + idx[2];
+		});
+
+		// copy to and from row-major arrays
+		BasicArray<int, 3> a(tiled.shape());
+		a << tiled;
+
+		TiledArray<int, 3> retiled(a.shape(), {8, 2, 16});
+		retiled << a;
+
+		BasicArray<long, 2> flat({70, 9});
+		flat << retiled;
+
+		// the padding of edge tiles does not take part in comparisons
+		TiledArray<int, 3> padded(tiled.shape(), tiled.tile(), -1);
+		padded << a;
+
+		if(tiled(9, 6, 8) == 968 && a(5, 3, 7) == 537 && retiled == tiled && padded == tiled &&
+		   a.equalValue(retiled) && flat.equalValue(tiled))
+			cout << "Good tiled array." << endl;
+		else
+			cout << "Bad tiled array." << endl;
+	}
+	// column-major layout and transposes
+	{
+		BasicArray<int, 3> a({4, 5, 6});
+		a.traverse([](const auto &idx, int &data){
+			data = idx[0] * 100 + idx[1] * 10 + idx[2];
+		});
+
+		// same indexes, Fortran order in memory
+		LayoutArray<int, 3> fortran(a.shape(), Layout<3>::columnMajor());
+		fortran << a;
+
+		// zero-copy transposes
+		auto reversed = a.transpose();
+		auto permuted = fortran.transpose(1, 2, 0);
+
+		// materialize a transpose
+		BasicArray<int, 3> b(reversed.shape());
+		b << reversed;
+
+		if(fortran == a && fortran.begin()[1] == 100 && fortran(3, 4, 5) == 345 && fortran[3][4][5] == 345 &&
+		   b(5, 4, 3) == 345 && permuted(4, 5, 3) == 345 && b.equalValue(reversed) && a.equalValue(fortran))
+			cout << "Good layouts." << endl;
+		else
+			cout << "Bad layouts." << endl;
+	}
+	// cache-blocked tiled traversal
+	{
+		BasicArray<int, 2> a({37, 53});
+		a.traverse([](const auto &idx, int &data){
+			data = idx[0] * 100 + idx[1];
+		});
+
+		// transposes with tiles not dividing the shape and with tiles fitting the caches
+		BasicArray<int, 2> t({53, 37});
+		t.traverseTiled([&a](const auto &idx, int &data){ data = a(idx[1], idx[0]); }, {8, 16});
+		BasicArray<int, 2> autoT({53, 37});
+		autoT.traverseTiled([&a](const auto &idx, int &data){ data = a(idx[1], idx[0]); });
+
+		// visit order: 2x3 tiles, down the columns of tiles
+		BasicArray<int, 2> order({4, 6});
+		int n = 0;
+		order.traverseTiled([&n](const auto&, int &data){ data = n++; }, {2, 3}, Layout<2>::columnMajor());
+
+		if(t.equalValue(a.transpose()) && autoT == t && order(0, 2) == 2 && order(1, 0) == 3 &&
+		   order(2, 0) == 6 && order(0, 3) == 12 && order(3, 5) == 23)
+			cout << "Good tiled traversal." << endl;
+		else
+			cout << "Bad tiled traversal." << endl;
+	}
+	// lock-step traversal of arrays of different types and layouts
+	{
+		BasicArray<int, 2> a({4, 6});
+		a.traverse([](const auto &idx, int &data){
+			data = idx[0] * 10 + idx[1];
+		});
+		BasicArray<float, 2> b({8, 6}, 0.5f);
+		auto everyOther = b.slice(Range(0, 8, 2), Range());
+		LayoutArray<double, 2> c(a.shape(), Layout<2>::columnMajor());
+
+		zipTraverse([](const auto &idx, double &cData, const int &aData, float bData){
+			cData = aData * 2 + bData + idx[0];
+		}, c, std::as_const(a), everyOther);
+
+		// without indexes
+		long sum = 0;
+		zipTraverse([&sum](int aData, double cData){ sum += static_cast<long>(cData) - 2 * aData; }, a, c);
+
+		bool thrown = false;
+		try
+		{
+			zipTraverse([](int, float){}, a, b);
+		}
+		catch(const std::runtime_error&)
+		{
+			thrown = true;
+		}
+
+		if(c(3, 5) == 73.5 && c(1, 2) == 25.5 && sum == 6 * 6 && thrown)
+			cout << "Good zip traversal." << endl;
+		else
+			cout << "Bad zip traversal." << endl;
+	}
+	// lazy element-wise arithmetic
+	{
+		BasicArray<float, 2> a({3, 4});
+		BasicArray<int, 2> b({3, 4});
+		a.traverse([](const auto &idx, float &data){ data = idx[0] + idx[1] * 0.5f; });
+		b.traverse([](const auto &idx, int &data){ data = idx[0] * 10 + idx[1]; });
+
+		BasicArray<double, 2> c(a.shape());
+		c << sqrt(a * a) * 2 + b - 1;
+
+		// mixed signedness does not wrap around
+		BasicArray<unsigned, 2> u(b.shape(), 5);
+		BasicArray<long long, 2> d(b.shape());
+		d << -b + u;
+
+		// transposed operands and destinations
+		BasicArray<int, 2> t({4, 3});
+		t << b.transpose() / 2;
+
+		BasicArray<int, 2> half(b.shape());
+		half.transpose() << t * 2;
+
+		if(c(2, 3) == 2 * 3.5 + 23 - 1 && d(2, 3) == -18 && t(3, 2) == 11 && half(2, 3) == 22)
+			cout << "Good expressions." << endl;
+		else
+			cout << "Bad expressions." << endl;
+	}
+	// reductions, in full and along an axis
+	{
+		util::ThreadPool pool(3);
+
+		BasicArray<int, 3> a({4, 5, 6});
+		a.traverse([](const auto &idx, int &data){ data = idx[0] * 100 + idx[1] * 10 + idx[2]; });
+		a(2, 3, 4) = 1000;
+
+		const auto sum0 = util::sum<0>(a);
+		const auto max2 = util::max<2>(a, pool);
+		const auto pos = util::argmax(a);
+
+		// other layouts give the same results
+		LayoutArray<int, 3> columnMajor(a.shape(), Layout<3>::columnMajor());
+		columnMajor << a;
+
+		// compensated sums of many small floats do not drift
+		BasicArray<float, 1> small({1 << 20}, 0.1f);
+
+		if(util::sum(a) == util::sum(a, pool) && sum0(1, 2) == 648 && max2(2, 3) == 1000 &&
+				pos == std::array<size_t, 3>{2, 3, 4} && util::min(a) == 0 &&
+				util::argmax(columnMajor) == pos && util::sum<1>(columnMajor) == util::sum<1>(a) &&
+				std::abs(util::sum(small, pool, util::Summation::Kahan) - 0.1 * (1 << 20)) < 0.1)
+			cout << "Good reductions." << endl;
+		else
+			cout << "Bad reductions." << endl;
+	}
+	// broadcasting smaller arrays without expanding them
+	{
+		BasicArray<float, 4> a({2, 3, 4, 5});
+		a.traverse([](const auto &idx, float &data){ data = idx[0] * 1000 + idx[1] * 100 + idx[2] * 10 + idx[3]; });
+
+		// per-channel scale along the last dimension, bias along dimension 1
+		BasicArray<float, 1> scale({5});
+		scale.traverse([](const auto &idx, float &data){ data = idx[0] + 1; });
+		BasicArray<float, 3> bias({3, 1, 1});
+		bias.traverse([](const auto &idx, float &data){ data = idx[0] * 0.5f; });
+
+		BasicArray<float, 4> c(a.shape());
+		c << a * scale + bias;
+
+		// zero strides on repeated dimensions
+		auto repeated = scale.broadcast(a.shape());
+
+		BasicArray<float, 2> rows({4, 5});
+		rows << scale * 2;
+
+		if(c(1, 2, 3, 4) == 1234 * 5 + 1 && repeated(1, 2, 3, 4) == 5 && repeated.strides()[2] == 0 &&
+				rows(3, 1) == 4)
+			cout << "Good broadcasting." << endl;
+		else
+			cout << "Bad broadcasting." << endl;
+	}
+	// bulk copies: memcpy, non-temporal stores, conversions and a thread pool
+	{
+		util::ThreadPool pool(3);
+
+		BasicArray<int, 2> a({2000, 1000});
+		a.traverse([](const auto &idx, int &data){ data = idx[0] * 1000 + idx[1]; });
+
+		BasicArray<int, 2> same(a.shape());
+		same << a;
+
+		// odd offsets take the unaligned head and tail
+		BasicArray<int, 1> streamed({a.size()}, 0);
+		util::bulkCopy(streamed.begin() + 1, a.begin() + 1, a.size() - 2, true);
+
+		BasicArray<float, 2> converted(a.shape());
+		converted.copyParallel(a, pool);
+
+		BasicArray<double, 2> wide(a.shape());
+		wide << a;
+		BasicArray<float, 2> narrow(a.shape());
+		narrow.copyParallel(wide, pool);
+
+		if(same == a && streamed(0) == 0 && streamed(1) == 1 && streamed(a.size() - 2) == 1999998 &&
+				streamed(a.size() - 1) == 0 && converted(1999, 999) == 1999999.0f && narrow == converted)
+			cout << "Good bulk copy." << endl;
+		else
+			cout << "Bad bulk copy." << endl;
+	}
+	// exact and approximate comparison
+	{
+		BasicArray<int, 2> a({300, 500});
+		a.traverse([](const auto &idx, int &data){ data = idx[0] * 1000 + idx[1]; });
+
+		BasicArray<int, 2> b(a.shape());
+		b << a;
+		BasicArray<unsigned, 2> u(a.shape());
+		u << a;
+
+		// negative numbers never equal unsigned ones
+		BasicArray<int, 2> minusOne(a.shape(), -1);
+		BasicArray<unsigned, 2> maxUnsigned(a.shape(), ~0u);
+
+		// a relative error, a neighbouring float and a NaN
+		BasicArray<float, 2> f(a.shape());
+		f << a;
+		BasicArray<double, 2> d(a.shape());
+		d << a;
+		f(10, 20) *= 1.001f;
+		f(20, 10) = nextafter(f(20, 10), 1e9f);
+		f(100, 3) = NAN;
+
+		const auto ulps = f.approxEqual(d, 0, 0, 1);
+		const auto relative = f.approxEqual(d, 0, 1e-2);
+
+		if(a == b && a.equalValue(u) && !minusOne.equalValue(maxUnsigned) &&
+				ulps.mismatches == 2 && ulps.firstMismatch == std::array<size_t, 2>{10, 20} &&
+				relative.mismatches == 1 && relative.firstMismatch == std::array<size_t, 2>{100, 3})
+			cout << "Good comparison." << endl;
+		else
+			cout << "Bad comparison." << endl;
+	}
+	// operations counted per tag if instrumentation is compiled in, nothing otherwise
+	{
+		BasicArray<int, 2> a({30, 50}, 1);
+		BasicArray<int, 2> b(a.shape());
+		{
+			ARRAY_INSTRUMENT_TAG("demo");
+			b << a;
+			b << a;
+			b.traverseValues([](int &data){ data++; });
+		}
+
+		uint64_t copies = 0;
+		uint64_t copiedBytes = 0;
+		uint64_t traversals = 0;
+		for(const auto &stats : util::Instrumentation::snapshot())
+		{
+			if(stats.tag == "demo" && stats.operation == util::Operation::Copy)
+			{
+				copies = stats.calls;
+				copiedBytes = stats.bytes;
+			}
+			if(stats.tag == "demo" && stats.operation == util::Operation::TraverseValues)
+				traversals = stats.calls;
+		}
+
+		const bool counted = util::Instrumentation::enabled() ?
+				copies == 2 && copiedBytes == 2 * a.size() * 2 * sizeof(int) && traversals == 1 :
+				!copies && !traversals;
+
+		if(counted && !a.equalValue(b))
+			cout << "Good instrumentation." << endl;
+		else
+			cout << "Bad instrumentation." << endl;
+	}
+	// parallel traversal gives the same result as the serial one
+	{
+		util::ThreadPool pool(3);
+
+		BasicArray<long, 3> serial({7, 3, 11});
+		BasicArray<long, 3> parallel(serial.shape());
+
+		auto fill = [](const auto &idx, long &data){
+			data = idx[0] * 10000 + idx[1] * 100 + idx[2];
+		};
+
+		serial.traverse(fill);
+		parallel.traverseParallel(fill, pool);
+
+		if(parallel == serial)
+			cout << "Good parallel traversal." << endl;
+		else
+			cout << "Bad parallel traversal." << endl;
+	}
+	// parallel first touch initialization
+	{
+		util::ThreadPool pool(3, true);
+
+		BasicArray<double, 3> a({30, 40, 50}, 0.5, pool);
+
+		// pages are reported on some node where NUMA is supported
+		size_t numPages = 1;
+		if(util::numaAvailable())
+		{
+			numPages = 0;
+			for(size_t count : util::numaPageCounts(a))
+				numPages += count;
+		}
+
+		if(a.equalValue(BasicArray<double, 3>(a.shape(), 0.5)) && numPages)
+			cout << "Good parallel initialization." << endl;
+		else
+			cout << "Bad parallel initialization." << endl;
+	}
 }
 
 }
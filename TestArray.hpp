@@ -19,31 +19,49 @@
 #define TEST_ARRAY_HPP
 
 #include "BasicArray.hpp"
+#include "Benchmark.hpp"
+#include "ThreadPool.hpp"
 
-#include <chrono>
+#include <cmath>
 #include <iostream>
+#include <string>
+#include <vector>
 
 /// Test namespace.
 namespace test
 {
 
-/// Number of test iterations.
-constexpr size_t NUM_TEST_ITER = 100;
-
 /// Number of test dimensions.
 constexpr size_t NUM_TEST_DIM = 4;
 
 typedef std::array<size_t, NUM_TEST_DIM> test_shape_t;
 
+/**
+ * @brief Name of an element type in benchmark results, e.g. float or int32.
+ */
+template<typename T>
+std::string typeName()
+{
+	if constexpr (std::is_floating_point_v<T>)
+		return sizeof(T) == 4 ? "float" : sizeof(T) == 8 ? "double" : "float" + std::to_string(8 * sizeof(T));
+	else
+		return (std::is_signed_v<T> ? "int" : "uint") + std::to_string(8 * sizeof(T));
+}
+
 /**
  * @brief Test access performance via optimized subscript operators.
  */
-void testArrayAccessMethod1(const test_shape_t &shape, float val);
+void testArrayAccessMethod1(const test_shape_t &shape, float val, util::Benchmark &bench);
 
 /**
  * @brief Test access performance via optimized variadic function template.
  */
-void testArrayAccessMethod2(const test_shape_t &shape, float val);
+void testArrayAccessMethod2(const test_shape_t &shape, float val, util::Benchmark &bench);
+
+/**
+ * @brief Test array construction followed by a write pass, with and without initialization.
+ */
+void testArrayConstruction(const test_shape_t &shape, float val, util::Benchmark &bench);
 
 /**
  * @brief Test access performance via an index traversing functor.
@@ -51,7 +69,7 @@ void testArrayAccessMethod2(const test_shape_t &shape, float val);
  * This method of access is most flexible and versatile.
  */
 template<typename T, size_t NDIM>
-void testArrayAccessMethod3(const std::array<size_t, NDIM> &shape, T val)
+void testArrayAccessMethod3(const std::array<size_t, NDIM> &shape, T val, util::Benchmark &bench)
 {
 	using namespace std;
 
@@ -61,21 +79,225 @@ void testArrayAccessMethod3(const std::array<size_t, NDIM> &shape, T val)
 	BasicArray<T, NDIM> a(shape);
 	cout << "Array size: " << a.size() << endl;
 
-	auto startTime = chrono::high_resolution_clock::now();
-
-	for(size_t t = 0; t < NUM_TEST_ITER; t++)
+	const auto &result = bench.run("traverse", typeName<T>(), {shape.begin(), shape.end()}, a.size(), sizeof(T), [&a, val]
 	{
 		a.traverse([val](const auto &idx, T &data)
 		{
 			data = val;
 		});
+		util::doNotOptimize(*a.begin());
+	});
+
+	cout << "Method 3 write time: " << result << '.' << endl;
+}
+
+/**
+ * @brief Test access performance via an index traversing functor run on a thread pool.
+ */
+template<typename T, size_t NDIM>
+void testArrayAccessMethod4(const std::array<size_t, NDIM> &shape, T val, util::ThreadPool &pool,
+							util::Benchmark &bench)
+{
+	using namespace std;
+
+	cout << "### Testing array access method 4 (parallel index visitor functor)." << endl;
+	cout << "Number of dimensions: " << shape.size() << endl;
+	cout << "Number of threads: " << pool.concurrency() << endl;
+
+	BasicArray<T, NDIM> a(shape);
+	cout << "Array size: " << a.size() << endl;
+
+	const auto &result = bench.run("traverseParallel", typeName<T>(), {shape.begin(), shape.end()}, a.size(), sizeof(T),
+								   [&a, val, &pool]
+	{
+		a.traverseParallel([val](const auto&, T &data)
+		{
+			data = val;
+		}, pool);
+		util::doNotOptimize(*a.begin());
+	});
+
+	cout << "Method 4 write time: " << result << '.' << endl;
+}
+
+/**
+ * @brief Test access performance via a value visitor functor.
+ *
+ * Contiguous dimensions are collapsed into a single flat loop.
+ */
+template<typename T, size_t NDIM>
+void testArrayAccessMethod5(const std::array<size_t, NDIM> &shape, T val, util::Benchmark &bench)
+{
+	using namespace std;
+
+	cout << "### Testing array access method 5 (value visitor functor)." << endl;
+	cout << "Number of dimensions: " << shape.size() << endl;
+
+	BasicArray<T, NDIM> a(shape);
+	cout << "Array size: " << a.size() << endl;
+
+	const auto &result = bench.run("traverseValues", typeName<T>(), {shape.begin(), shape.end()}, a.size(), sizeof(T),
+								   [&a, val]
+	{
+		a.traverseValues([val](T &data)
+		{
+			data = val;
+		});
+		util::doNotOptimize(*a.begin());
+	});
+
+	cout << "Method 5 write time: " << result << '.' << endl;
+}
+
+/**
+ * @brief Hand-written loop nest writing a(i0, i1, ...), one explicit loop per dimension.
+ */
+template<size_t DIM = 0, typename ARRAY, typename T, typename... IDX>
+void writeLoopNest(ARRAY &a, T val, IDX... idx)
+{
+	if constexpr (DIM == ARRAY::ndim)
+		a(idx...) = val;
+	else
+	{
+		for(size_t i = 0; i < a.template dim<DIM>(); i++)
+			writeLoopNest<DIM + 1>(a, val, idx..., i);
 	}
+}
+
+/**
+ * @brief Compare an index visitor functor with a hand-written loop nest for a number of dimensions.
+ *
+ * The loop nest accesses the array as in testArrayAccessMethod1().
+ * The array shape is a hypercube with about targetSize elements.
+ */
+template<size_t NDIM>
+void testTraversalDim(size_t targetSize, float val, util::Benchmark &bench)
+{
+	using namespace std;
+
+	array<size_t, NDIM> shape;
+	shape.fill(max<size_t>(2, static_cast<size_t>(round(pow(targetSize, 1.0 / NDIM)))));
+
+	BasicArray<float, NDIM> a(shape);
+	const vector<size_t> shapeVec(shape.begin(), shape.end());
+
+	const auto loop = bench.run("loopNest", "float", shapeVec, a.size(), sizeof(float), [&a, val]
+	{
+		writeLoopNest(a, val);
+		util::doNotOptimize(*a.begin());
+	});
+	cout << loop << '.' << endl;
 
-	auto endTime = chrono::high_resolution_clock::now();
-	auto durationNanos = chrono::duration<double, nano>(endTime - startTime).count();
-    cout << "Method 3 write time: " << durationNanos/(NUM_TEST_ITER * a.size()) << " ns." << endl;
+	const auto &traversal = bench.run("traverse", "float", shapeVec, a.size(), sizeof(float), [&a, val]
+	{
+		a.traverse([val](const auto&, float &data)
+		{
+			data = val;
+		});
+		util::doNotOptimize(*a.begin());
+	});
+	cout << traversal << '.' << endl;
+
+	cout << "NDIM " << NDIM << ", shape " << shape[0] << "^" << NDIM << ": traverse to loop nest ratio " <<
+			traversal.median / loop.median << endl;
 }
 
+/**
+ * @brief Compare an index visitor functor with a hand-written loop nest for 1 to 8 dimensions.
+ */
+void testTraversalDims(size_t targetSize, float val, util::Benchmark &bench);
+
+/**
+ * @brief Compare tiled and row-major layouts on sweeps along the first dimension.
+ *
+ * Column-wise sweeps of a 2D array and plane-wise sweeps of a 3D array
+ * with about targetSize elements.
+ */
+void testTiledLayout(size_t targetSize, float val, util::Benchmark &bench);
+
+/**
+ * @brief Compare copying a row-major array to a column-major one element by element
+ *        with the cache-oblivious copy, for a square 2D array of about targetSize elements.
+ */
+void testTranspose(size_t targetSize, float val, util::Benchmark &bench);
+
+/**
+ * @brief Compare a fused expression with temporaries and a hand-written traversal,
+ *        for a 2D array of about targetSize elements.
+ */
+void testExpression(size_t targetSize, float val, util::Benchmark &bench);
+
+/**
+ * @brief Compare full and per-axis sums with an accumulating traversal, serial, on a thread pool and compensated,
+ *        for a 2D array of about targetSize elements.
+ */
+void testReduction(size_t targetSize, float val, util::ThreadPool &pool, util::Benchmark &bench);
+
+/**
+ * @brief Compare a broadcast expression with expanding the smaller operand to full size,
+ *        for a 2D array of about targetSize elements scaled per column.
+ */
+void testBroadcast(size_t targetSize, float val, util::Benchmark &bench);
+
+/**
+ * @brief Compare copy bandwidth of an element loop with bulk copies of the same type,
+ *        conversions and copies on a thread pool, for a 2D array of about targetSize elements.
+ */
+void testBulkCopy(size_t targetSize, float val, util::ThreadPool &pool, util::Benchmark &bench);
+
+/**
+ * @brief Compare bandwidth of an element loop with exact comparison of the same type,
+ *        of mixed signedness and approximate comparison, for a 2D array of about targetSize elements.
+ */
+void testCompare(size_t targetSize, float val, util::Benchmark &bench);
+
+/**
+ * @brief Compare cloning a basic array with cloning a copy-on-write array, read only and written,
+ *        for a 2D array of about targetSize elements.
+ */
+void testCopyOnWrite(size_t targetSize, float val, util::Benchmark &bench);
+
+/**
+ * @brief Count heap allocations and time of constructing and copying 3x3 arrays
+ *        with and without inline storage.
+ */
+void testSmallArrays(float val, util::Benchmark &bench);
+
+/**
+ * @brief Compare growing a vector of arrays by moves with copies, about targetSize elements in total.
+ */
+void testArrayMoves(size_t targetSize, float val, util::Benchmark &bench);
+
+/**
+ * @brief Compare traversing every other column of a 2D array of about targetSize elements
+ *        with std::transform over its iterators, and time random access.
+ */
+void testStandardAlgorithms(size_t targetSize, float val, util::Benchmark &bench);
+
+/**
+ * @brief Compare a traversal indexing other arrays with lock-step traversals with and without indexes,
+ *        for a square 2D array of about targetSize elements.
+ */
+void testZipTraversal(size_t targetSize, float val, util::Benchmark &bench);
+
+/**
+ * @brief Compare writing the transpose of a square 2D array of about targetSize elements
+ *        by a traversal with tiled traversals of fixed and cache-sized tiles.
+ */
+void testTiledTraversal(size_t targetSize, float val, util::Benchmark &bench);
+
+/**
+ * @brief Measure the cost per call of a traversal over few elements,
+ *        with or without instrumentation compiled in.
+ */
+void testInstrumentation(float val, util::Benchmark &bench);
+
+/**
+ * @brief Benchmark access methods and views over element types, numbers of dimensions
+ *        and cache-resident and DRAM-sized shapes.
+ */
+void benchmarkAccess(util::Benchmark &bench);
+
 /**
  * @brief Examples of array view code.
  */
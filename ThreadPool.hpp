@@ -0,0 +1,332 @@
+/**
+ * @file
+ *
+ * @brief Work-stealing thread pool.
+ *
+ * @details
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace util
+{
+
+/**
+ * @brief Persistent work-stealing thread pool.
+ *
+ * @details Every worker owns a task queue. A worker takes tasks from the back of its own queue
+ *          and steals from the front of the other queues when its own queue runs dry.
+ *          The thread calling parallelFor() takes part in the work until its tasks are done,
+ *          so a pool with zero workers simply runs everything on the calling thread.
+ *          Chunk k of every parallelFor() call is queued to queue k modulo the number of queues,
+ *          so calls with the same partitioning give each thread the same chunks, unless they are stolen.
+ *          With workers pinned to CPUs, data first touched by a chunk then mostly stays
+ *          on the NUMA node of the thread which processes that chunk later.
+ */
+class ThreadPool
+{
+public:
+	typedef std::function<void()> task_t;
+
+	/**
+	 * @brief Start the workers.
+	 *
+	 * @details By default one worker per hardware thread, less the calling thread.
+	 *          Pinned workers each run on one CPU the process may use, the first CPU being left to the calling thread.
+	 */
+	explicit ThreadPool(size_t numWorkers = defaultNumWorkers(), bool pinWorkers = false):
+		_numQueued(0),
+		_pinned(false),
+		_stop(false)
+	{
+		// The calling thread uses an extra queue of its own.
+		for(size_t i = 0; i <= numWorkers; i++)
+			_queues.emplace_back(std::make_unique<Queue>());
+
+		for(size_t i = 0; i < numWorkers; i++)
+			_workers.emplace_back([this, i]{ workerLoop(i); });
+
+		if(pinWorkers)
+			_pinned = pin();
+	}
+
+	/**
+	 * @brief Stop and join the workers.
+	 */
+	~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stop = true;
+		}
+		_wakeUp.notify_all();
+
+		for(std::thread &worker : _workers)
+			worker.join();
+	}
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/**
+	 * @brief Number of threads taking part in parallelFor(), including the calling thread.
+	 */
+	size_t concurrency() const
+	{
+		return _workers.size() + 1;
+	}
+
+	/**
+	 * @brief Check if all workers are pinned to CPUs.
+	 */
+	bool pinned() const
+	{
+		return _pinned;
+	}
+
+	/**
+	 * @brief Run fun(chunkBegin, chunkEnd) over [begin, end) split into chunks of at most grain items.
+	 *
+	 * @details Blocks until all the chunks are done.
+	 *          Rethrows the first exception thrown by the functor.
+	 */
+	template<typename FUN>
+	void parallelFor(size_t begin, size_t end, size_t grain, FUN &&fun)
+	{
+		if(begin >= end)
+			return;
+
+		grain = std::max<size_t>(grain, 1);
+		const size_t numChunks = (end - begin + grain - 1) / grain;
+
+		// Nothing to share.
+		if(numChunks == 1 || _workers.empty())
+		{
+			for(size_t first = begin; first < end; first += grain)
+				fun(first, std::min(first + grain, end));
+			return;
+		}
+
+		Latch latch(numChunks);
+
+		for(size_t chunk = 0; chunk < numChunks; chunk++)
+		{
+			const size_t first = begin + chunk * grain;
+			const size_t last = std::min(first + grain, end);
+
+			push(chunk % _queues.size(), [&fun, &latch, first, last]
+			{
+				try
+				{
+					fun(first, last);
+				}
+				catch(...)
+				{
+					latch.setException(std::current_exception());
+				}
+				latch.countDown();
+			});
+		}
+
+		// Help out while waiting.
+		const size_t self = _workers.size();
+		task_t task;
+		while(!latch.done() && pop(self, task))
+			task();
+
+		latch.wait();
+		latch.rethrow();
+	}
+
+	/**
+	 * @brief Default number of workers.
+	 */
+	static size_t defaultNumWorkers()
+	{
+		const size_t numThreads = std::thread::hardware_concurrency();
+		return numThreads > 1 ? numThreads - 1 : 0;
+	}
+
+private:
+
+	// Task queue owned by a thread.
+	struct Queue
+	{
+		std::mutex mutex;
+		std::deque<task_t> tasks;
+	};
+
+	// Completion counter of a parallelFor() call.
+	class Latch
+	{
+	public:
+		explicit Latch(size_t count): _count(count) {}
+
+		void countDown()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if(--_count == 0)
+				_allDone.notify_all();
+		}
+
+		bool done()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			return _count == 0;
+		}
+
+		void wait()
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_allDone.wait(lock, [this]{ return _count == 0; });
+		}
+
+		void setException(std::exception_ptr exception)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if(!_exception)
+				_exception = exception;
+		}
+
+		void rethrow()
+		{
+			if(_exception)
+				std::rethrow_exception(_exception);
+		}
+
+	private:
+		std::mutex _mutex;
+		std::condition_variable _allDone;
+		size_t _count;
+		std::exception_ptr _exception;
+	};
+
+	std::vector<std::unique_ptr<Queue>> _queues;
+	std::vector<std::thread> _workers;
+	std::mutex _mutex;
+	std::condition_variable _wakeUp;
+	std::atomic<size_t> _numQueued;
+	bool _pinned;
+	bool _stop;
+
+	// Pin worker i to the (i + 1)-th CPU the process may use, cycling when there are more workers than CPUs.
+	bool pin()
+	{
+#ifdef __linux__
+		cpu_set_t allowed;
+		CPU_ZERO(&allowed);
+		if(sched_getaffinity(0, sizeof(allowed), &allowed))
+			return false;
+
+		std::vector<int> cpus;
+		for(int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+			if(CPU_ISSET(cpu, &allowed))
+				cpus.push_back(cpu);
+
+		bool pinned = !cpus.empty();
+		for(size_t i = 0; i < _workers.size() && pinned; i++)
+		{
+			cpu_set_t cpu;
+			CPU_ZERO(&cpu);
+			CPU_SET(cpus[(i + 1) % cpus.size()], &cpu);
+			pinned = !pthread_setaffinity_np(_workers[i].native_handle(), sizeof(cpu), &cpu);
+		}
+		return pinned;
+#else
+		return false;
+#endif
+	}
+
+	// Queue a task to a queue.
+	void push(size_t queueIndex, task_t task)
+	{
+		Queue &queue = *_queues[queueIndex];
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.tasks.push_back(std::move(task));
+		}
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_numQueued++;
+		}
+		_wakeUp.notify_one();
+	}
+
+	// Take a task from the own queue or steal one from the others.
+	bool pop(size_t self, task_t &task)
+	{
+		const size_t numQueues = _queues.size();
+
+		for(size_t i = 0; i < numQueues; i++)
+		{
+			Queue &queue = *_queues[(self + i) % numQueues];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+
+			if(queue.tasks.empty())
+				continue;
+
+			if(i == 0)
+			{
+				task = std::move(queue.tasks.back());
+				queue.tasks.pop_back();
+			}
+			else
+			{
+				task = std::move(queue.tasks.front());
+				queue.tasks.pop_front();
+			}
+			_numQueued--;
+			return true;
+		}
+		return false;
+	}
+
+	void workerLoop(size_t self)
+	{
+		task_t task;
+
+		while(true)
+		{
+			if(pop(self, task))
+			{
+				task();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(_mutex);
+			_wakeUp.wait(lock, [this]{ return _stop || _numQueued > 0; });
+			if(_stop)
+				return;
+		}
+	}
+};
+
+}
+
+#endif // THREAD_POOL_HPP
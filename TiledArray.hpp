@@ -0,0 +1,573 @@
+/**
+ * @file
+ *
+ * @brief Tiled (blocked) array.
+ *
+ * @details Elements are stored in contiguous tiles, so accesses moving along
+ *          any dimension stay within few cache lines and pages.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef TILED_ARRAY_HPP
+#define TILED_ARRAY_HPP
+
+#include "BasicArrayView.hpp"
+
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Tiled storage layout.
+ *
+ * @details Tiles are stored one after another in row-major order of the tile grid,
+ *          elements within a tile in row-major order.
+ *          Tile extents are powers of two, so the element offset is a sum
+ *          of shifts and masks of the indexes, one term per dimension.
+ *          Edge tiles are padded to the full tile size.
+ */
+template<size_t NDIM>
+struct TiledLayout
+{
+	/// Type of shape container.
+	typedef std::array<size_t, NDIM> shape_t;
+
+	/// Array shape.
+	shape_t shape;
+	/// Tile shape.
+	shape_t tile;
+	/// Tile index shift per dimension.
+	shape_t shifts;
+	/// Index within tile mask per dimension.
+	shape_t masks;
+	/// Strides of elements within a tile.
+	shape_t tileStrides;
+	/// Strides of tiles within the grid, in number of elements.
+	shape_t gridStrides;
+	/// Number of elements of a tile.
+	size_t tileSize;
+	/// Number of tiles.
+	size_t numTiles;
+
+	/**
+	 * @brief Layout of an array shape in tiles.
+	 *
+	 * @details Tile extents longer than the rounded up dimension are shortened.
+	 *
+	 * @throws Runtime error if a tile extent is not a power of two.
+	 */
+	TiledLayout(const shape_t &shape, shape_t tile):
+		shape(shape),
+		tile(tile)
+	{
+		for(size_t dim = 0; dim < NDIM; dim++)
+		{
+			if(!this->tile[dim] || (this->tile[dim] & (this->tile[dim] - 1)))
+				throw std::runtime_error("Tile extents must be powers of two.");
+
+			while(this->tile[dim] / 2 >= shape[dim] && this->tile[dim] > 1)
+				this->tile[dim] /= 2;
+
+			shifts[dim] = 0;
+			while(size_t(1) << shifts[dim] < this->tile[dim])
+				shifts[dim]++;
+			masks[dim] = this->tile[dim] - 1;
+		}
+
+		tileSize = 1;
+		numTiles = 1;
+		for(size_t dim = NDIM; dim-- > 0;)
+		{
+			tileStrides[dim] = tileSize;
+			tileSize *= this->tile[dim];
+		}
+		for(size_t dim = NDIM; dim-- > 0;)
+		{
+			gridStrides[dim] = numTiles * tileSize;
+			numTiles *= (shape[dim] + this->tile[dim] - 1) >> shifts[dim];
+		}
+	}
+
+	/**
+	 * @brief Offset contribution of an index of a dimension.
+	 */
+	size_t offset(size_t dim, size_t idx) const
+	{
+		return (idx >> shifts[dim]) * gridStrides[dim] + (idx & masks[dim]) * tileStrides[dim];
+	}
+
+	/**
+	 * @brief Computes element offset given array indexes.
+	 */
+	template<typename... IDX>
+	size_t computeOffset(IDX... idx) const
+	{
+		static_assert(sizeof...(idx) == NDIM,
+				"Number of array indexes must be equal to number of dimensions.");
+
+		return computeOffset(std::make_index_sequence<NDIM>(), idx...);
+	}
+
+private:
+	template<size_t... DIM, typename... IDX>
+	size_t computeOffset(std::index_sequence<DIM...>, IDX... idx) const
+	{
+		return (offset(DIM, static_cast<size_t>(idx)) + ...);
+	}
+};
+
+/**
+ * @brief Iterator visiting tiled array elements in row-major order of the indexes.
+ *
+ * @details Advances the innermost index and propagates the carry to the outer ones.
+ *          Used to copy and compare with other array types;
+ *          traversal functions walk tile by tile instead.
+ */
+template<typename ITER, size_t NDIM>
+class TiledIterator
+{
+public:
+
+	/// Type of shape container.
+	typedef std::array<size_t, NDIM> shape_t;
+
+	typedef std::forward_iterator_tag iterator_category;
+	typedef std::remove_cv_t<std::remove_reference_t<decltype(*std::declval<ITER>())>> value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef decltype(*std::declval<ITER>()) reference;
+	typedef ITER pointer;
+
+	TiledIterator(): _iter(), _layout(nullptr), _pos(0), _idx{0} {}
+
+	/**
+	 * @brief Iterator at the row-major position pos.
+	 */
+	TiledIterator(ITER data, const TiledLayout<NDIM> &layout, size_t pos):
+		_iter(data),
+		_layout(&layout),
+		_pos(pos),
+		_idx{0}
+	{
+		for(size_t dim = NDIM; dim-- > 0 && pos;)
+		{
+			_idx[dim] = dim ? pos % layout.shape[dim] : pos;
+			_iter += layout.offset(dim, _idx[dim]);
+			pos /= layout.shape[dim];
+		}
+	}
+
+	reference operator*() const
+	{
+		return *_iter;
+	}
+
+	pointer operator->() const
+	{
+		return _iter;
+	}
+
+	TiledIterator& operator++()
+	{
+		_pos++;
+		for(size_t dim = NDIM; dim-- > 0;)
+		{
+			const size_t idx = _idx[dim]++;
+
+			// within a tile the next element is one tile stride away
+			if((_idx[dim] & _layout->masks[dim]) && _idx[dim] < _layout->shape[dim])
+			{
+				_iter += _layout->tileStrides[dim];
+				break;
+			}
+
+			_iter -= _layout->offset(dim, idx);
+			if(_idx[dim] < _layout->shape[dim] || !dim)
+			{
+				_iter += _layout->offset(dim, _idx[dim]);
+				break;
+			}
+			_idx[dim] = 0;
+		}
+		return *this;
+	}
+
+	TiledIterator operator++(int)
+	{
+		TiledIterator old(*this);
+		++*this;
+		return old;
+	}
+
+	bool operator==(const TiledIterator &other) const
+	{
+		return _pos == other._pos;
+	}
+
+	bool operator!=(const TiledIterator &other) const
+	{
+		return _pos != other._pos;
+	}
+
+	/**
+	 * @brief Current array indexes.
+	 */
+	const shape_t& index() const
+	{
+		return _idx;
+	}
+
+private:
+	ITER _iter;
+	const TiledLayout<NDIM> *_layout;
+	size_t _pos;
+	shape_t _idx;
+};
+
+/**
+ * @brief Tiled (blocked) array class.
+ *
+ * @details Stores elements in contiguous tiles of a configurable shape, e.g. 32x32 or 8x8x8.
+ *          Sweeps along any dimension touch a tile worth of cache lines instead of
+ *          a cache line per element as with row-major storage.
+ *          Traversal walks tile by tile; copying and comparing with other array types
+ *          follows the row-major order of the indexes.
+ */
+template<typename T, size_t NDIM>
+class TiledArray final: public ArrayBase<NDIM>
+{
+public:
+
+	/// This type.
+	typedef TiledArray<T, NDIM> this_t;
+	/// Base type.
+	typedef ArrayBase<NDIM> base_t;
+	/// Type of shape container.
+	typedef typename base_t::shape_t shape_t;
+	/// Data type.
+	typedef T data_t;
+	/// Iterator type.
+	typedef TiledIterator<T*, NDIM> iterator;
+	/// Constant iterator type.
+	typedef TiledIterator<const T*, NDIM> const_iterator;
+	/// Reference type.
+	typedef T& reference;
+	/// Constant reference type.
+	typedef const T& const_reference;
+
+	/**
+	 * @brief Constructors which initializes with default value.
+	 *
+	 * @throws Runtime error if a tile extent is not a power of two.
+	 */
+	TiledArray(shape_t shape, const shape_t &tile):
+		TiledArray(std::move(shape), tile, T())
+	{
+	}
+
+	/**
+	 * @brief Constructors which initializes with provided value.
+	 *
+	 * @throws Runtime error if a tile extent is not a power of two.
+	 */
+	TiledArray(shape_t shape, const shape_t &tile, const T &value):
+		base_t(std::move(shape)),
+		_layout(this->_shape, tile),
+		_container(_layout.numTiles * _layout.tileSize, value)
+	{
+	}
+
+	/**
+	 * @brief Get the tile shape.
+	 */
+	const shape_t& tile() const
+	{
+		return _layout.tile;
+	}
+
+	/**
+	 * @brief Get the storage layout.
+	 */
+	const TiledLayout<NDIM>& layout() const
+	{
+		return _layout;
+	}
+
+	/**
+	 * @brief Get begin iterator.
+	 */
+	iterator begin()
+	{
+		return iterator(_container.data(), _layout, 0);
+	}
+
+	/**
+	 * @brief Get const begin iterator.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator(_container.data(), _layout, 0);
+	}
+
+	/**
+	 * @brief Get end iterator.
+	 */
+	iterator end()
+	{
+		return iterator(_container.data(), _layout, this->_size);
+	}
+
+	/**
+	 * @brief Get const end iterator.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator(_container.data(), _layout, this->_size);
+	}
+
+	/**
+	 * @brief Computes element offset given array indexes.
+	 *
+	 * @details Hides the base version which assumes row-major storage.
+	 */
+	template<typename... IDX>
+	size_t computeOffset(IDX... idx) const
+	{
+		return _layout.computeOffset(idx...);
+	}
+
+	/**
+	 * @brief Access elements of the array via indexes.
+	 */
+	template<typename... IDX>
+	reference operator()(IDX... idx)
+	{
+		return _container[computeOffset(idx...)];
+	}
+
+	/**
+	 * @brief Access elements of the constant array via indexes.
+	 */
+	template<typename... IDX>
+	const_reference operator()(IDX... idx) const
+	{
+		return _container[computeOffset(idx...)];
+	}
+
+	/**
+	 * @brief Traverse array indexes tile by tile while calling a functor.
+	 */
+	template<typename FUN>
+	void traverse(FUN &&fun)
+	{
+		forEachTile<T*>(0, _layout.numTiles, [&fun](auto &&traversal){ traversal.traverse(fun); });
+	}
+
+	/**
+	 * @brief Traverse array indexes tile by tile while calling a functor.
+	 */
+	template<typename FUN>
+	void traverse(FUN &&fun) const
+	{
+		forEachTile<const T*>(0, _layout.numTiles, [&fun](auto &&traversal){ traversal.traverse(fun); });
+	}
+
+	/**
+	 * @brief Traverse array elements tile by tile while calling a functor without indexes.
+	 */
+	template<typename FUN>
+	void traverseValues(FUN &&fun)
+	{
+		forEachTile<T*>(0, _layout.numTiles, [&fun](auto &&traversal){ traversal.traverseValues(fun); });
+	}
+
+	/**
+	 * @brief Traverse array elements tile by tile while calling a functor without indexes.
+	 */
+	template<typename FUN>
+	void traverseValues(FUN &&fun) const
+	{
+		forEachTile<const T*>(0, _layout.numTiles, [&fun](auto &&traversal){ traversal.traverseValues(fun); });
+	}
+
+	/**
+	 * @brief Traverse array indexes on a thread pool while calling a functor.
+	 *
+	 * @details Tiles are shared among the threads, each tile is traversed by one thread.
+	 *          The functor is called concurrently and must be safe to call from several threads.
+	 */
+	template<typename FUN>
+	void traverseParallel(FUN &&fun, util::ThreadPool &pool)
+	{
+		pool.parallelFor(0, _layout.numTiles, 1, [this, &fun](size_t first, size_t last)
+		{
+			forEachTile<T*>(first, last, [&fun](auto &&traversal){ traversal.traverse(fun); });
+		});
+	}
+
+	/**
+	 * @brief Traverse array indexes on a thread pool while calling a functor.
+	 *
+	 * @details Tiles are shared among the threads, each tile is traversed by one thread.
+	 *          The functor is called concurrently and must be safe to call from several threads.
+	 */
+	template<typename FUN>
+	void traverseParallel(FUN &&fun, util::ThreadPool &pool) const
+	{
+		pool.parallelFor(0, _layout.numTiles, 1, [this, &fun](size_t first, size_t last)
+		{
+			forEachTile<const T*>(first, last, [&fun](auto &&traversal){ traversal.traverse(fun); });
+		});
+	}
+
+	/**
+	 * @brief Comparison operator
+	 *
+	 * @details Compares the elements only, not the padding of edge tiles.
+	 */
+	bool operator==(const this_t &other) const
+	{
+		if(this == &other)
+			return true;
+
+		if(this->_shape != other._shape)
+			return false;
+
+		// same storage layout: elements are at the same offsets
+		if(_layout.tile == other._layout.tile)
+		{
+			const T *thisData = _container.data();
+			const T *otherData = other._container.data();
+			bool equal = true;
+
+			traverseValues([thisData, otherData, &equal](const T &data)
+			{
+				equal = equal && data == otherData[&data - thisData];
+			});
+			return equal;
+		}
+
+		const const_iterator thisIterEnd = end();
+		const_iterator thisIter = begin();
+		const_iterator otherIter = other.begin();
+
+		for(; thisIter != thisIterEnd && *thisIter == *otherIter; ++thisIter, ++otherIter);
+		return thisIter == thisIterEnd;
+	}
+
+	/**
+	 * @brief Copy data operator.
+	 *
+	 * @details Copies from any array view of the same size, in row-major order of the indexes.
+	 *          A source of the same shape is read tile by tile via its indexes.
+	 *
+	 * @throws Runtime error of array sizes are unequal.
+	 */
+	template<typename OTHER>
+	std::enable_if_t<is_array_view_v<OTHER>, TiledArray&>
+	operator<<(const OTHER &other)
+	{
+		if(reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
+			return *this;
+
+		if(this->_size != other.size())
+			throw std::runtime_error("Cannot copy data: array sizes do not match.");
+
+		if constexpr (OTHER::ndim == NDIM)
+		{
+			if constexpr (std::is_same_v<OTHER, this_t>)
+			{
+				if(_layout.tile == other._layout.tile)
+				{
+					std::copy(other._container.begin(), other._container.end(), _container.begin());
+					return *this;
+				}
+			}
+
+			if(other.shape() == this->_shape)
+			{
+				traverse([&other](const shape_t &idx, T &data)
+				{
+					data = std::apply(other, idx);
+				});
+				return *this;
+			}
+		}
+
+		auto otherIter = indexBegin(other);
+		for(T &data : *this)
+		{
+			data = *otherIter;
+			++otherIter;
+		}
+
+		return *this;
+	}
+
+	/**
+	 * @brief Scientifically motivated comparing of stored values.
+	 *
+	 * @details Allows scientific number comparison without copying.
+	 *          Return false if array sizes differ.
+	 */
+	template<typename OTHER>
+	std::enable_if_t<is_array_view_v<OTHER>, bool>
+	equalValue(const OTHER &other) const
+	{
+		if(reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
+			return true;
+
+		if(this->_size != other.size())
+			return false;
+
+		const const_iterator thisIterEnd = end();
+		const_iterator thisIter = begin();
+		auto otherIter = indexBegin(other);
+
+		for(; thisIter != thisIterEnd && util::eq(*thisIter, *otherIter); ++thisIter, ++otherIter);
+		return thisIter == thisIterEnd;
+	}
+
+private:
+	// The dense row-major strides of the base do not address tiled storage.
+	using base_t::strides;
+	using base_t::isRowMajor;
+
+	TiledLayout<NDIM> _layout;
+	std::vector<T> _container;
+
+	// Call fun with a traversal of the valid part of each tile in [first, last).
+	template<typename ITER, typename FUN>
+	void forEachTile(size_t first, size_t last, FUN &&fun) const
+	{
+		ITER data = const_cast<T*>(_container.data()) + first * _layout.tileSize;
+
+		for(size_t tile = first; tile < last; tile++, data += _layout.tileSize)
+		{
+			shape_t start;
+			shape_t end;
+			for(size_t dim = NDIM, rest = tile; dim-- > 0;)
+			{
+				const size_t gridLen = (this->_shape[dim] + _layout.tile[dim] - 1) >> _layout.shifts[dim];
+				start[dim] = (rest % gridLen) << _layout.shifts[dim];
+				end[dim] = std::min(start[dim] + _layout.tile[dim], this->_shape[dim]);
+				rest /= gridLen;
+			}
+
+			fun(BasicArrayTraversal<ITER, NDIM>(data, start, end, _layout.tileStrides));
+		}
+	}
+};
+
+// Tiled arrays match the array view types.
+template<typename T, size_t NDIM>
+std::true_type arrayViewMatch(const TiledArray<T, NDIM>*);
+
+#endif // TILED_ARRAY_HPP
@@ -0,0 +1,259 @@
+/**
+ * @file
+ *
+ * @brief Lock-step traversal of several arrays.
+ *
+ * @details One iterator per array is advanced by the strides of its own array,
+ *          so no element offsets are computed from indexes.
+ *
+ * @authors
+ * - Alex Ken
+ *
+ * @version
+ * - 10/16/2026 Initial version.
+ *
+ * @copyright Alexander Ken
+ *
+ * @par License: The MIT License (MIT)
+ */
+#ifndef ZIP_TRAVERSAL_HPP
+#define ZIP_TRAVERSAL_HPP
+
+#include "Instrumentation.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Class for traversing multidimensional arrays of the same shape in lock step.
+ *
+ * @details The arrays may have different element types and strides.
+ *          Like BasicArrayTraversal, each dimension is iterated by its own template instantiation.
+ */
+template<size_t NDIM, typename... ITER>
+class ZipTraversal
+{
+public:
+
+	static_assert(NDIM, "Number of array dimensions must be larger than zero.");
+	static_assert(sizeof...(ITER), "At least one array must be traversed.");
+
+	/// Number of traversed arrays.
+	constexpr static size_t NUM_ARRAYS = sizeof...(ITER);
+
+	/// Type of shape container.
+	typedef std::array<size_t, NDIM> shape_t;
+
+	/**
+	 * @brief Traversal of arrays of a shape, given the data and strides of each array.
+	 */
+	ZipTraversal(const shape_t &shape, const std::tuple<ITER...> &data, const std::array<shape_t, NUM_ARRAYS> &strides):
+		_data(data),
+		_shape(shape)
+	{
+		for(size_t dim = 0; dim < NDIM; dim++)
+			for(size_t k = 0; k < NUM_ARRAYS; k++)
+				_strides[dim][k] = strides[k][dim];
+	}
+
+	/**
+	 * @brief Traverse arrays and apply functor to the indexes and an element of each array.
+	 *
+	 * @details A functor taking only the elements does not need indexes,
+	 *          so it is passed on to traverseValues().
+	 */
+	template<typename FUN>
+	void traverse(FUN &&fun) const
+	{
+		if constexpr (takes_values_only<FUN>)
+			traverseValues(std::forward<FUN>(fun));
+		else
+		{
+			shape_t idx{0};
+
+			iterate<0>(_data, idx, std::forward<FUN>(fun));
+		}
+	}
+
+	/**
+	 * @brief Traverse array elements without indexes and apply functor.
+	 *
+	 * @details Neighbouring dimensions contiguous in all arrays are collapsed into one,
+	 *          so dense arrays of the same layout are walked by a single flat loop.
+	 */
+	template<typename FUN>
+	void traverseValues(FUN &&fun) const
+	{
+		shape_t len;
+		std::array<strides_t, NDIM> strides;
+		collapse(len, strides);
+
+		iterateValues<0>(_data, len, strides, std::forward<FUN>(fun));
+	}
+
+private:
+	// Strides of all arrays along a dimension.
+	typedef std::array<size_t, NUM_ARRAYS> strides_t;
+	typedef std::tuple<ITER...> iters_t;
+	typedef std::make_index_sequence<NUM_ARRAYS> arrays_t;
+
+	const iters_t _data;
+	const shape_t _shape;
+	std::array<strides_t, NDIM> _strides;
+
+	// Whether the functor is called with the elements only.
+	template<typename FUN>
+	constexpr static bool takes_values_only =
+			std::is_invocable_v<FUN, decltype(*std::declval<ITER>())...> &&
+			!std::is_invocable_v<FUN, const shape_t&, decltype(*std::declval<ITER>())...>;
+
+	template<size_t... K>
+	static void advance(iters_t &iters, const strides_t &strides, std::index_sequence<K...>)
+	{
+		((std::get<K>(iters) += strides[K]), ...);
+	}
+
+	template<typename FUN, size_t... K>
+	static void call(FUN &&fun, const shape_t &idx, const iters_t &iters, std::index_sequence<K...>)
+	{
+		fun(idx, *std::get<K>(iters)...);
+	}
+
+	template<typename FUN, size_t... K>
+	static void callValues(FUN &&fun, const iters_t &iters, std::index_sequence<K...>)
+	{
+		fun(*std::get<K>(iters)...);
+	}
+
+	template<typename FUN, size_t... K>
+	static void callValues(FUN &&fun, const iters_t &iters, size_t i, std::index_sequence<K...>)
+	{
+		fun(std::get<K>(iters)[i]...);
+	}
+
+	template<size_t DIM, typename FUN>
+	void iterate(iters_t iters, shape_t &idx, FUN &&fun) const
+	{
+		const size_t end = _shape[DIM];
+		const strides_t &strides = _strides[DIM];
+		size_t &i = idx[DIM];
+
+		// last dimension to iterate
+		if constexpr (DIM == NDIM - 1)
+		{
+			for(i = 0; i < end; i++, advance(iters, strides, arrays_t()))
+				call(fun, idx, iters, arrays_t());
+		}
+		// continue iteration
+		else
+		{
+			for(i = 0; i < end; i++, advance(iters, strides, arrays_t()))
+				iterate<DIM + 1>(iters, idx, std::forward<FUN>(fun));
+		}
+	}
+
+	// Merge neighbouring dimensions contiguous in all arrays.
+	// The result is right aligned: leading unused dimensions get unit length.
+	void collapse(shape_t &len, std::array<strides_t, NDIM> &strides) const
+	{
+		len.fill(1);
+		strides.fill(strides_t{0});
+
+		size_t dim = NDIM - 1;
+		len[dim] = _shape[dim];
+		strides[dim] = _strides[dim];
+
+		for(size_t i = NDIM - 1; i-- > 0;)
+		{
+			const size_t dimLen = _shape[i];
+
+			if(dimLen == 1)
+				continue;
+
+			bool contiguous = true;
+			for(size_t k = 0; k < NUM_ARRAYS; k++)
+				contiguous = contiguous && _strides[i][k] == strides[dim][k] * len[dim];
+
+			if(len[dim] == 1)
+			{
+				len[dim] = dimLen;
+				strides[dim] = _strides[i];
+			}
+			else if(contiguous)
+				len[dim] *= dimLen;
+			else
+			{
+				dim--;
+				len[dim] = dimLen;
+				strides[dim] = _strides[i];
+			}
+		}
+	}
+
+	template<size_t DIM, typename FUN>
+	static void iterateValues(iters_t iters, const shape_t &len,
+							  const std::array<strides_t, NDIM> &strides, FUN &&fun)
+	{
+		const size_t n = len[DIM];
+
+		// last dimension to iterate: a flat loop
+		if constexpr (DIM == NDIM - 1)
+		{
+			bool unitStrides = true;
+			for(size_t stride : strides[DIM])
+				unitStrides = unitStrides && stride == 1;
+
+			if(unitStrides)
+			{
+				for(size_t i = 0; i < n; i++)
+					callValues(fun, iters, i, arrays_t());
+			}
+			else
+			{
+				for(size_t i = 0; i < n; i++, advance(iters, strides[DIM], arrays_t()))
+					callValues(fun, iters, arrays_t());
+			}
+		}
+		// continue iteration
+		else
+		{
+			for(size_t i = 0; i < n; i++, advance(iters, strides[DIM], arrays_t()))
+				iterateValues<DIM + 1>(iters, len, strides, std::forward<FUN>(fun));
+		}
+	}
+};
+
+/**
+ * @brief Traverse arrays of the same shape in lock step while calling a functor
+ *        with the indexes and an element of each array, fun(idx, a(idx), b(idx), ...).
+ *
+ * @details Arrays are anything with data(), shape() and strides(), e.g. basic, strided and fixed arrays,
+ *          of any element types and layouts. Elements of const arrays are passed as const.
+ *          A functor taking only the elements, fun(a(idx), b(idx), ...), is called as by traverseValues(),
+ *          in memory order when all arrays share it.
+ *          A non-const copy-on-write array is detached, pass it as const to read it.
+ *
+ * @throws Runtime error if the array shapes do not match.
+ */
+template<typename FUN, typename ARRAY, typename... ARRAYS>
+void zipTraverse(FUN &&fun, ARRAY &&array, ARRAYS &&... arrays)
+{
+	constexpr size_t NDIM = std::tuple_size_v<std::decay_t<decltype(array.shape())>>;
+	static_assert(((std::tuple_size_v<std::decay_t<decltype(arrays.shape())>> == NDIM) && ...),
+			"Arrays must have the same number of dimensions.");
+
+	const std::array<size_t, NDIM> shape = array.shape();
+	if(((arrays.shape() != shape) || ...))
+		throw std::runtime_error("Cannot traverse arrays: array shapes do not match.");
+
+	ARRAY_INSTRUMENT(util::Operation::Traverse, array.size(),
+			array.size() * (sizeof(*array.data()) + ... + sizeof(*arrays.data())));
+	ZipTraversal<NDIM, decltype(array.data()), decltype(arrays.data())...>(shape,
+			std::make_tuple(array.data(), arrays.data()...), {array.strides(), arrays.strides()...}).
+			traverse(std::forward<FUN>(fun));
+}
+
+#endif // ZIP_TRAVERSAL_HPP